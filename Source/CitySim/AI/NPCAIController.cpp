@@ -8,6 +8,17 @@ void ANPCAIController::OnPossess(APawn* P)
     GetWorldTimerManager().SetTimer(Timer, this, &ANPCAIController::MoveToRandomPoint, RepathTime, true, 0.5f);
 }
 
+void ANPCAIController::PauseWandering()
+{
+    StopMovement();
+    GetWorldTimerManager().PauseTimer(Timer);
+}
+
+void ANPCAIController::ResumeWandering()
+{
+    GetWorldTimerManager().UnPauseTimer(Timer);
+}
+
 void ANPCAIController::MoveToRandomPoint()
 {
     APawn* P = GetPawn(); if (!P) return;
@@ -11,6 +11,10 @@ class BELIVE_API ANPCAIController : public AAIController
 public:
     virtual void OnPossess(APawn* InPawn) override;
 
+    // For pooled NPCs going dormant and coming back
+    void PauseWandering();
+    void ResumeWandering();
+
 private:
     UPROPERTY(EditDefaultsOnly, Category = "AI")
     float WanderRadius = 1200.f;
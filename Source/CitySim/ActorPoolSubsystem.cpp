@@ -0,0 +1,202 @@
+#include "ActorPoolSubsystem.h"
+#include "CityGameMode.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+
+DECLARE_CYCLE_STAT(TEXT("Pool Acquire"), STAT_ActorPoolAcquire, STATGROUP_ActorPool);
+DECLARE_CYCLE_STAT(TEXT("Pool Release"), STAT_ActorPoolRelease, STATGROUP_ActorPool);
+DECLARE_CYCLE_STAT(TEXT("Pool Prewarm"), STAT_ActorPoolPrewarm, STATGROUP_ActorPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Hits"), STAT_ActorPoolHits, STATGROUP_ActorPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pool Misses"), STAT_ActorPoolMisses, STATGROUP_ActorPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Pooled Actors Free"), STAT_ActorPoolFree, STATGROUP_ActorPool);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Worst Acquire (ms)"), STAT_ActorPoolWorstAcquire, STATGROUP_ActorPool);
+
+// Where dormant actors wait, out of sight and out of everyone's way
+static const FVector PoolParkingLocation(0.0f, 0.0f, -100000.0f);
+
+void UActorPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // Before any actor's BeginPlay, so the spawn cost lands in the loading screen
+    if (const ACityGameMode* GameMode = InWorld.GetAuthGameMode<ACityGameMode>())
+    {
+        for (const TPair<TSubclassOf<AActor>, int32>& Entry : GameMode->PrewarmedActors)
+        {
+            Prewarm(Entry.Key, Entry.Value);
+        }
+    }
+}
+
+void UActorPoolSubsystem::Deinitialize()
+{
+    Pools.Reset();
+    Super::Deinitialize();
+}
+
+void UActorPoolSubsystem::Prewarm(UClass* Class, int32 Count)
+{
+    if (!Class) return;
+
+    SCOPE_CYCLE_COUNTER(STAT_ActorPoolPrewarm);
+    FActorPool& Pool = Pools.FindOrAdd(Class);
+    Pool.Free.RemoveAll([](const AActor* Actor) { return !IsValid(Actor); });
+    while (Pool.Free.Num() < Count)
+    {
+        AActor* Actor = SpawnPooledActor(Class, FTransform(PoolParkingLocation));
+        if (!Actor) break;
+
+        ++Pool.NumSpawned;
+        MakeDormant(Actor);
+        Pool.Free.Add(Actor);
+    }
+    UpdateStats();
+}
+
+AActor* UActorPoolSubsystem::Acquire(UClass* Class, const FTransform& Transform)
+{
+    if (!Class) return nullptr;
+
+    SCOPE_CYCLE_COUNTER(STAT_ActorPoolAcquire);
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+
+    FActorPool& Pool = Pools.FindOrAdd(Class);
+    AActor* Actor = nullptr;
+    while (!Actor && Pool.Free.Num() > 0)
+    {
+        // Someone may have destroyed it while it was pooled
+        Actor = Pool.Free.Pop(false);
+        if (!IsValid(Actor))
+        {
+            Actor = nullptr;
+        }
+    }
+
+    if (Actor)
+    {
+        ++Pool.Hits;
+        ++TotalHits;
+        Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+        if (IPoolableActor* Poolable = Cast<IPoolableActor>(Actor))
+        {
+            Poolable->OnAcquiredFromPool();
+        }
+        else
+        {
+            Actor->SetActorHiddenInGame(false);
+            Actor->SetActorEnableCollision(true);
+            Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+        }
+    }
+    else
+    {
+        // The hitch pooling is meant to avoid; raise the prewarm count if this shows up
+        ++Pool.Misses;
+        ++TotalMisses;
+        Actor = SpawnPooledActor(Class, Transform);
+        if (Actor)
+        {
+            ++Pool.NumSpawned;
+        }
+    }
+
+    const uint64 Cycles = FPlatformTime::Cycles64() - StartCycles;
+    Pool.WorstAcquireCycles = FMath::Max(Pool.WorstAcquireCycles, Cycles);
+    WorstAcquireCycles = FMath::Max(WorstAcquireCycles, Cycles);
+    UpdateStats();
+    return Actor;
+}
+
+void UActorPoolSubsystem::Release(AActor* Actor)
+{
+    if (!IsValid(Actor)) return;
+
+    SCOPE_CYCLE_COUNTER(STAT_ActorPoolRelease);
+    FActorPool& Pool = Pools.FindOrAdd(Actor->GetClass());
+    if (Pool.Free.Contains(Actor)) return;
+
+    MakeDormant(Actor);
+    Pool.Free.Add(Actor);
+    UpdateStats();
+}
+
+int32 UActorPoolSubsystem::GetNumFree(UClass* Class) const
+{
+    const FActorPool* Pool = Pools.Find(Class);
+    return Pool ? Pool->Free.Num() : 0;
+}
+
+void UActorPoolSubsystem::LogReport(bool bReset)
+{
+    for (TPair<TObjectPtr<UClass>, FActorPool>& Entry : Pools)
+    {
+        FActorPool& Pool = Entry.Value;
+        UE_LOG(LogTemp, Log, TEXT("Actor pool %s: %d spawned, %d free, %d hits, %d misses, worst acquire %.3f ms"),
+            *GetNameSafe(Entry.Key), Pool.NumSpawned, Pool.Free.Num(), Pool.Hits, Pool.Misses, FPlatformTime::ToMilliseconds64(Pool.WorstAcquireCycles));
+
+        if (bReset)
+        {
+            Pool.Hits = 0;
+            Pool.Misses = 0;
+            Pool.WorstAcquireCycles = 0;
+        }
+    }
+
+    if (bReset)
+    {
+        TotalHits = 0;
+        TotalMisses = 0;
+        WorstAcquireCycles = 0;
+        UpdateStats();
+    }
+}
+
+AActor* UActorPoolSubsystem::SpawnPooledActor(UClass* Class, const FTransform& Transform)
+{
+    FActorSpawnParameters Params;
+    Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    return GetWorld()->SpawnActor<AActor>(Class, Transform, Params);
+}
+
+void UActorPoolSubsystem::MakeDormant(AActor* Actor)
+{
+    if (IPoolableActor* Poolable = Cast<IPoolableActor>(Actor))
+    {
+        Poolable->OnReleasedToPool();
+    }
+    else
+    {
+        Actor->SetActorHiddenInGame(true);
+        Actor->SetActorEnableCollision(false);
+        Actor->SetActorTickEnabled(false);
+    }
+
+    // Physics is off by now, so this is a plain teleport
+    Actor->SetActorLocation(PoolParkingLocation, false, nullptr, ETeleportType::ResetPhysics);
+}
+
+void UActorPoolSubsystem::UpdateStats()
+{
+    TotalFree = 0;
+    for (const TPair<TObjectPtr<UClass>, FActorPool>& Entry : Pools)
+    {
+        TotalFree += Entry.Value.Free.Num();
+    }
+
+    SET_DWORD_STAT(STAT_ActorPoolHits, TotalHits);
+    SET_DWORD_STAT(STAT_ActorPoolMisses, TotalMisses);
+    SET_DWORD_STAT(STAT_ActorPoolFree, TotalFree);
+    SET_FLOAT_STAT(STAT_ActorPoolWorstAcquire, FPlatformTime::ToMilliseconds64(WorstAcquireCycles));
+}
+
+static FAutoConsoleCommandWithWorldAndArgs ActorPoolReportCommand(
+    TEXT("ActorPool.Report"),
+    TEXT("Logs pool hits, misses and worst-case acquire time for every pooled class. Usage: ActorPool.Report [Reset=0]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        UActorPoolSubsystem* ActorPool = World ? World->GetSubsystem<UActorPoolSubsystem>() : nullptr;
+        if (!ActorPool) return;
+
+        ActorPool->LogReport(Args.Num() > 0 && FCString::Atoi(*Args[0]) != 0);
+    }));
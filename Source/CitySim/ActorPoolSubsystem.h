@@ -0,0 +1,88 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ActorPoolSubsystem.generated.h"
+
+DECLARE_STATS_GROUP(TEXT("Actor Pool"), STATGROUP_ActorPool, STATCAT_Advanced);
+
+UINTERFACE(MinimalAPI, meta = (CannotImplementInterfaceInBlueprint))
+class UPoolableActor : public UInterface
+{
+    GENERATED_BODY()
+};
+
+// Reset hooks for actors handed out by UActorPoolSubsystem. Actors without it are only hidden
+// and have collision and tick turned off while pooled.
+class BELIVE_API IPoolableActor
+{
+    GENERATED_BODY()
+
+public:
+    // Already moved to the requested transform; come back looking like a fresh spawn
+    virtual void OnAcquiredFromPool() = 0;
+
+    // Drop any per-use state and go dormant: hidden, no collision, no tick, no physics
+    virtual void OnReleasedToPool() = 0;
+};
+
+// Dormant actors of one class, plus counters for the pool report
+USTRUCT()
+struct FActorPool
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<AActor>> Free;
+
+    int32 NumSpawned = 0;
+    int32 Hits = 0;
+    int32 Misses = 0;
+    uint64 WorstAcquireCycles = 0;
+};
+
+// Keeps spawned actors around instead of destroying them, so populating the city doesn't pay for
+// constructing every component of a vehicle or NPC mid-game. Classes listed in
+// ACityGameMode::PrewarmedActors are spawned while the level loads; an empty pool still hands
+// out a freshly spawned actor but counts it as a miss.
+UCLASS()
+class BELIVE_API UActorPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+    virtual void Deinitialize() override;
+
+    // Spawns dormant actors until Class has at least Count free
+    void Prewarm(UClass* Class, int32 Count);
+
+    AActor* Acquire(UClass* Class, const FTransform& Transform);
+
+    template<typename T>
+    T* Acquire(TSubclassOf<T> Class, const FTransform& Transform)
+    {
+        return Cast<T>(Acquire(Class.Get(), Transform));
+    }
+
+    // Makes Actor dormant and keeps it for the next Acquire of its class
+    void Release(AActor* Actor);
+
+    int32 GetNumFree(UClass* Class) const;
+
+    // Logs hits, misses and worst acquire time per class
+    void LogReport(bool bReset);
+
+private:
+    UPROPERTY()
+    TMap<TObjectPtr<UClass>, FActorPool> Pools;
+
+    int32 TotalHits = 0;
+    int32 TotalMisses = 0;
+    int32 TotalFree = 0;
+    uint64 WorstAcquireCycles = 0;
+
+    AActor* SpawnPooledActor(UClass* Class, const FTransform& Transform);
+    void MakeDormant(AActor* Actor);
+    void UpdateStats();
+};
@@ -1,5 +1,6 @@
 #include "Characters/NPCCharacter.h"
 #include "AI/NPCAIController.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
 ANPCCharacter::ANPCCharacter()
@@ -10,3 +11,39 @@ ANPCCharacter::ANPCCharacter()
 }
 
 void ANPCCharacter::BeginPlay() { Super::BeginPlay(); }
+
+void ANPCCharacter::OnAcquiredFromPool()
+{
+    SetActorHiddenInGame(false);
+    SetActorEnableCollision(true);
+    SetActorTickEnabled(true);
+    GetMesh()->SetComponentTickEnabled(true);
+
+    UCharacterMovementComponent* Movement = GetCharacterMovement();
+    Movement->SetComponentTickEnabled(true);
+    Movement->SetDefaultMovementMode();
+
+    if (ANPCAIController* AI = Cast<ANPCAIController>(GetController()))
+    {
+        AI->ResumeWandering();
+    }
+}
+
+void ANPCCharacter::OnReleasedToPool()
+{
+    if (ANPCAIController* AI = Cast<ANPCAIController>(GetController()))
+    {
+        AI->PauseWandering();
+    }
+
+    // No falling or animating while parked out of sight
+    UCharacterMovementComponent* Movement = GetCharacterMovement();
+    Movement->StopMovementImmediately();
+    Movement->DisableMovement();
+    Movement->SetComponentTickEnabled(false);
+
+    GetMesh()->SetComponentTickEnabled(false);
+    SetActorTickEnabled(false);
+    SetActorEnableCollision(false);
+    SetActorHiddenInGame(true);
+}
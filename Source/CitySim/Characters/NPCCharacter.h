@@ -1,16 +1,21 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "ActorPoolSubsystem.h"
 #include "NPCCharacter.generated.h"
 
 UCLASS()
-class BELIVE_API ANPCCharacter : public ACharacter
+class BELIVE_API ANPCCharacter : public ACharacter, public IPoolableActor
 {
     GENERATED_BODY()
 
 public:
     ANPCCharacter();
 
+    // Pooled NPCs keep their AI controller; wandering is paused while dormant
+    virtual void OnAcquiredFromPool() override;
+    virtual void OnReleasedToPool() override;
+
 protected:
     virtual void BeginPlay() override;
 };
@@ -9,4 +9,9 @@ class BELIVE_API ACityGameMode : public AGameModeBase
     GENERATED_BODY()
 public:
     ACityGameMode();
+
+    // Spawned dormant into UActorPoolSubsystem while the level loads, so populating the city
+    // later reuses them instead of constructing new actors mid-game
+    UPROPERTY(EditDefaultsOnly, Category = "Pooling")
+    TMap<TSubclassOf<AActor>, int32> PrewarmedActors;
 };
@@ -1,5 +1,29 @@
 #include "Interaction/NearbyInteractComponent.h"
+#include "Vehicles/VehicleSignificanceSubsystem.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "Engine/World.h"
+
+void UNearbyInteractComponent::OnRegister()
+{
+    Super::OnRegister();
+
+    UWorld* World = GetWorld();
+    if (UVehicleSignificanceSubsystem* Significance = World ? World->GetSubsystem<UVehicleSignificanceSubsystem>() : nullptr)
+    {
+        Significance->RegisterWaker(this);
+    }
+}
+
+void UNearbyInteractComponent::OnUnregister()
+{
+    UWorld* World = GetWorld();
+    if (UVehicleSignificanceSubsystem* Significance = World ? World->GetSubsystem<UVehicleSignificanceSubsystem>() : nullptr)
+    {
+        Significance->UnregisterWaker(this);
+    }
+
+    Super::OnUnregister();
+}
 
 AActor* UNearbyInteractComponent::FindClosestUsable() const
 {
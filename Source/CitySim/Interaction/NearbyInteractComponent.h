@@ -13,4 +13,9 @@ public:
     float Radius = 250.f;
 
     AActor* FindClosestUsable() const;
+
+protected:
+    // Registers with the vehicle significance subsystem so parked vehicles in reach wake up
+    virtual void OnRegister() override;
+    virtual void OnUnregister() override;
 };
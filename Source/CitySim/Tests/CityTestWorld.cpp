@@ -0,0 +1,69 @@
+#include "Tests/CityTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "Vehicles/VehicleBase.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+
+static TAutoConsoleVariable<FString> CVarTestVehicleClass(
+    TEXT("Vehicle.TestClass"), TEXT(""),
+    TEXT("AVehicleBase blueprint the vehicle automation tests drive, e.g. /Game/Vehicles/BP_Car.BP_Car_C."));
+
+FCityTestWorld::FCityTestWorld(bool bTickPhysicsAsync)
+{
+    UPhysicsSettings* PhysicsSettings = UPhysicsSettings::Get();
+    bRestoreTickPhysicsAsync = PhysicsSettings->bTickPhysicsAsync;
+    PhysicsSettings->bTickPhysicsAsync = bTickPhysicsAsync;
+
+    World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("CityTestWorld"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+}
+
+FCityTestWorld::~FCityTestWorld()
+{
+    GEngine->DestroyWorldContext(World);
+    World->DestroyWorld(false);
+    UPhysicsSettings::Get()->bTickPhysicsAsync = bRestoreTickPhysicsAsync;
+}
+
+void FCityTestWorld::Tick(float DeltaTime, int32 Frames)
+{
+    for (int32 Frame = 0; Frame < Frames; ++Frame)
+    {
+        World->Tick(LEVELTICK_All, DeltaTime);
+    }
+}
+
+AStaticMeshActor* FCityTestWorld::SpawnFloor()
+{
+    // Static mobility only takes a mesh before it is registered
+    const FTransform Transform(FRotator::ZeroRotator, FVector(0.0f, 0.0f, -50.0f), FVector(400.0f, 400.0f, 1.0f));
+    AStaticMeshActor* Floor = World->SpawnActorDeferred<AStaticMeshActor>(AStaticMeshActor::StaticClass(), Transform);
+    Floor->GetStaticMeshComponent()->SetStaticMesh(LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube")));
+    Floor->FinishSpawning(Transform);
+    return Floor;
+}
+
+UClass* FCityTestWorld::LoadVehicleClass(FAutomationTestBase& Test)
+{
+    const FString Path = CVarTestVehicleClass.GetValueOnGameThread();
+    UClass* VehicleClass = Path.IsEmpty() ? nullptr : LoadClass<AVehicleBase>(nullptr, *Path);
+    if (!VehicleClass)
+    {
+        Test.AddError(FString::Printf(TEXT("Set Vehicle.TestClass to an AVehicleBase blueprint with a mesh and wheels (got '%s')"), *Path));
+    }
+    return VehicleClass;
+}
+
+#endif
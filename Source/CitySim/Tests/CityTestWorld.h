@@ -0,0 +1,36 @@
+#pragma once
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+class UWorld;
+class AStaticMeshActor;
+class FAutomationTestBase;
+
+// Empty game world for automation tests, begun play on construction and torn down on
+// destruction. Runs headless under -nullrhi; nothing in it is rendered.
+class FCityTestWorld
+{
+public:
+    // Async physics has to be chosen before the world's physics scene is created
+    explicit FCityTestWorld(bool bTickPhysicsAsync = false);
+    ~FCityTestWorld();
+
+    UWorld* GetWorld() const { return World; }
+
+    // Ticks the whole world, physics included, Frames times at DeltaTime
+    void Tick(float DeltaTime, int32 Frames = 1);
+
+    // 400 m square of the engine cube with its top at Z = 0, default physical surface
+    AStaticMeshActor* SpawnFloor();
+
+    // Vehicle blueprint named by Vehicle.TestClass, for tests that need a mesh and wheels; the C++
+    // vehicle classes have neither. Adds an error to Test and returns null if it doesn't load.
+    static UClass* LoadVehicleClass(FAutomationTestBase& Test);
+
+private:
+    UWorld* World = nullptr;
+    bool bRestoreTickPhysicsAsync = false;
+};
+
+#endif
@@ -0,0 +1,95 @@
+#include "Tests/CityTestWorld.h"
+#include "Vehicles/VehicleBase.h"
+#include "Vehicles/FixedStepVehicleMovementComponent.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Both frame rates hand physics the same input at the same steps, so the runs should only
+    // part by solver noise; this is how far apart, in cm, they may come to rest
+    constexpr float FrameRateTolerance = 5.0f;
+
+    constexpr double DriveTime = 6.0;
+    constexpr double StopTime = 4.0;
+
+    // Half a second per segment, a whole number of frames at both 30 and 144 fps. Ends on the
+    // handbrake; the foot brake would reverse once the vehicle stops.
+    FVehicleInputFrame ScriptedInput(double Time)
+    {
+        FVehicleInputFrame Input;
+        if (Time >= DriveTime)
+        {
+            Input.bHandbrake = true;
+            return Input;
+        }
+
+        const int32 Segment = FMath::FloorToInt32(Time / 0.5 + UE_KINDA_SMALL_NUMBER);
+        Input.Throttle = Segment % 3 == 2 ? 0.3f : 1.0f;
+        Input.Steer = Segment % 4 < 2 ? 0.6f : -0.6f;
+        Input.Brake = Segment % 5 == 4 ? 1.0f : 0.0f;
+        return Input;
+    }
+
+    // Drives a fresh vehicle through the script at FrameRate and returns where it came to rest
+    bool Drive(FAutomationTestBase& Test, UClass* VehicleClass, bool bFixedStepInput, double FrameRate, FVector& OutLocation)
+    {
+        FCityTestWorld TestWorld(true);
+        UWorld* World = TestWorld.GetWorld();
+        TestWorld.SpawnFloor();
+
+        const FTransform VehicleTransform(FVector(0.0f, 0.0f, 50.0f));
+        AVehicleBase* Vehicle = World->SpawnActorDeferred<AVehicleBase>(VehicleClass, VehicleTransform);
+        Vehicle->bStartAsleep = false;
+        Vehicle->bFixedStepInput = bFixedStepInput;
+        Vehicle->FinishSpawning(VehicleTransform);
+
+        const UFixedStepVehicleMovementComponent* Movement = Cast<UFixedStepVehicleMovementComponent>(Vehicle->GetVehicleMovementComponent());
+        if (!Test.TestNotNull(TEXT("Vehicle movement component"), Movement)) return false;
+        Test.TestEqual(TEXT("Smoothing per physics step"), Movement->IsSmoothingPerPhysicsStep(), bFixedStepInput);
+
+        // Half a physics step first, so no frame the script changes on starts exactly on a step
+        // boundary, then a second to settle on the wheels
+        const float DeltaTime = (float)(1.0 / FrameRate);
+        TestWorld.Tick(UPhysicsSettings::Get()->AsyncFixedTimeStepSize * 0.5f);
+        TestWorld.Tick(DeltaTime, FMath::RoundToInt32(FrameRate));
+
+        const int32 Frames = FMath::RoundToInt32((DriveTime + StopTime) * FrameRate);
+        for (int32 Frame = 0; Frame < Frames; ++Frame)
+        {
+            Vehicle->SetInputFrame(ScriptedInput(Frame / FrameRate));
+            TestWorld.Tick(DeltaTime);
+        }
+
+        OutLocation = Vehicle->GetActorLocation();
+        return true;
+    }
+}
+
+// A real vehicle on async physics, driven through the same input at 30 and 144 fps
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFixedStepVehicleFrameRateTest, "BeLive.Vehicles.FixedStepFrameRate",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FFixedStepVehicleFrameRateTest::RunTest(const FString& Parameters)
+{
+    UClass* VehicleClass = FCityTestWorld::LoadVehicleClass(*this);
+    if (!VehicleClass) return false;
+
+    FVector FixedStep30, FixedStep144, PerFrame30, PerFrame144;
+    if (!Drive(*this, VehicleClass, true, 30.0, FixedStep30) || !Drive(*this, VehicleClass, true, 144.0, FixedStep144)) return false;
+    if (!Drive(*this, VehicleClass, false, 30.0, PerFrame30) || !Drive(*this, VehicleClass, false, 144.0, PerFrame144)) return false;
+
+    const float FixedStepDistance = FVector::Dist(FixedStep30, FixedStep144);
+    const float PerFrameDistance = FVector::Dist(PerFrame30, PerFrame144);
+    AddInfo(FString::Printf(TEXT("Rest position 30 vs 144 fps: per physics step %.2f cm apart, per frame %.2f cm apart, ending %.0f m from the start"),
+        FixedStepDistance, PerFrameDistance, FixedStep144.Size2D() / 100.0f));
+
+    TestTrue(TEXT("Vehicle moved"), FixedStep144.Size2D() > 1000.0f);
+    TestTrue(*FString::Printf(TEXT("Per-step rest positions within %.0f cm"), FrameRateTolerance), FixedStepDistance <= FrameRateTolerance);
+    return true;
+}
+
+#endif
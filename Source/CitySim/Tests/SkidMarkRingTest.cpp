@@ -0,0 +1,72 @@
+#include "Vehicles/SkidMarkManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// The skid mark ring buffer through filling, wrapping and lapping; needs no world
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSkidMarkRingTest, "BeLive.Vehicles.SkidMarkRing",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSkidMarkRingTest::RunTest(const FString& Parameters)
+{
+    auto MakeMark = [](int32 Id) { return FTransform(FVector(Id, 0.0f, 0.0f)); };
+
+    int32 First[2];
+    int32 Count[2];
+    FSkidMarkRing Ring;
+    Ring.Init(4);
+    TestEqual(TEXT("Capacity after Init"), Ring.GetCapacity(), 4);
+    TestEqual(TEXT("Count after Init"), Ring.Num(), 0);
+    TestEqual(TEXT("Oldest after Init"), Ring.GetOldest(), 0);
+    TestTrue(TEXT("Unused slots are zero-scaled"), Ring.GetMarks()[0].GetScale3D().IsZero());
+    TestEqual(TEXT("Nothing dirty after Init"), Ring.ConsumeDirtyRanges(First, Count), 0);
+
+    // Partly full: slots 0..2 in one run
+    TestEqual(TEXT("First mark goes into slot 0"), Ring.Add(MakeMark(1)), 0);
+    TestEqual(TEXT("Second mark goes into slot 1"), Ring.Add(MakeMark(2)), 1);
+    TestEqual(TEXT("Third mark goes into slot 2"), Ring.Add(MakeMark(3)), 2);
+    TestEqual(TEXT("Count while filling"), Ring.Num(), 3);
+    TestEqual(TEXT("Oldest while filling"), Ring.GetOldest(), 0);
+    if (TestEqual(TEXT("One dirty run while filling"), Ring.ConsumeDirtyRanges(First, Count), 1))
+    {
+        TestEqual(TEXT("Dirty run start while filling"), First[0], 0);
+        TestEqual(TEXT("Dirty run length while filling"), Count[0], 3);
+    }
+
+    // Wraps: slots 3, 0, 1 overwrite the oldest first and split into two runs
+    TestEqual(TEXT("Fourth mark fills the last slot"), Ring.Add(MakeMark(4)), 3);
+    TestEqual(TEXT("Fifth mark recycles slot 0"), Ring.Add(MakeMark(5)), 0);
+    TestEqual(TEXT("Sixth mark recycles slot 1"), Ring.Add(MakeMark(6)), 1);
+    TestEqual(TEXT("Count once full"), Ring.Num(), 4);
+    TestEqual(TEXT("Oldest once full"), Ring.GetOldest(), 2);
+    TestEqual(TEXT("Overwritten mark"), Ring.GetMarks()[0].GetLocation().X, 5.0);
+    TestEqual(TEXT("Surviving mark"), Ring.GetMarks()[2].GetLocation().X, 3.0);
+    if (TestEqual(TEXT("Two dirty runs across the wrap"), Ring.ConsumeDirtyRanges(First, Count), 2))
+    {
+        TestEqual(TEXT("Run before the wrap starts at slot 3"), First[0], 3);
+        TestEqual(TEXT("Run before the wrap is one slot"), Count[0], 1);
+        TestEqual(TEXT("Run after the wrap starts at slot 0"), First[1], 0);
+        TestEqual(TEXT("Run after the wrap is two slots"), Count[1], 2);
+    }
+
+    // Laps the ring between flushes: everything dirty once
+    for (int32 Id = 7; Id < 17; ++Id)
+    {
+        Ring.Add(MakeMark(Id));
+    }
+    if (TestEqual(TEXT("One dirty run after a lap"), Ring.ConsumeDirtyRanges(First, Count), 1))
+    {
+        TestEqual(TEXT("Lap run starts at slot 0"), First[0], 0);
+        TestEqual(TEXT("Lap run covers the ring"), Count[0], 4);
+    }
+    TestEqual(TEXT("Oldest after a lap"), Ring.GetMarks()[Ring.GetOldest()].GetLocation().X, 13.0);
+
+    FSkidMarkRing Empty;
+    Empty.Init(0);
+    TestEqual(TEXT("Zero capacity takes nothing"), Empty.Add(MakeMark(1)), (int32)INDEX_NONE);
+    TestEqual(TEXT("Zero capacity has nothing dirty"), Empty.ConsumeDirtyRanges(First, Count), 0);
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,67 @@
+#include "Vehicles/TrafficSubsystem.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Samples of a 1000 cm lane along +X, or a 400 cm square loop through the origin
+    FTrafficLanePath MakeLane(bool bClosedLoop)
+    {
+        FTrafficLanePath Lane;
+        Lane.Spacing = 100.0f;
+        Lane.bClosedLoop = bClosedLoop;
+        if (bClosedLoop)
+        {
+            Lane.Points = { FVector(0, 0, 0), FVector(100, 0, 0), FVector(100, 100, 0), FVector(0, 100, 0), FVector(0, 0, 0) };
+        }
+        else
+        {
+            for (int32 Index = 0; Index <= 10; ++Index)
+            {
+                Lane.Points.Add(FVector(Index * 100.0f, 0, 0));
+            }
+        }
+        Lane.Length = (Lane.Points.Num() - 1) * Lane.Spacing;
+        return Lane;
+    }
+}
+
+// Vehicles handed back to the proxies keep their place along and across the lane
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTrafficLanePathProjectTest, "BeLive.Traffic.LanePathProject",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FTrafficLanePathProjectTest::RunTest(const FString& Parameters)
+{
+    const FTrafficLanePath Open = MakeLane(false);
+    float Lateral = 0.0f;
+
+    // Between samples, either side of the nearest one; +Y is right of +X
+    TestEqual(TEXT("Distance past the nearest sample"), Open.Project(FVector(430, 25, 0), 400.0f, 2000.0f, &Lateral), 430.0f, 0.01f);
+    TestEqual(TEXT("Lateral offset right of the lane"), Lateral, 25.0f, 0.01f);
+    TestEqual(TEXT("Distance short of the nearest sample"), Open.Project(FVector(371, -40, 0), 400.0f, 2000.0f, &Lateral), 371.0f, 0.01f);
+    TestEqual(TEXT("Lateral offset left of the lane"), Lateral, -40.0f, 0.01f);
+
+    // Beyond either end of an open lane
+    TestEqual(TEXT("Before the start"), Open.Project(FVector(-50, 0, 0), 0.0f, 2000.0f), 0.0f, 0.01f);
+    TestEqual(TEXT("Past the end"), Open.Project(FVector(1200, 0, 0), 1000.0f, 2000.0f), 1000.0f, 0.01f);
+
+    // A closed lane wraps from its last segment to its first
+    const FTrafficLanePath Loop = MakeLane(true);
+    TestEqual(TEXT("Last segment of a loop"), Loop.Project(FVector(0, 30, 0), 0.0f, 200.0f, &Lateral), 370.0f, 0.01f);
+    TestEqual(TEXT("Lateral offset on a loop's last segment"), Lateral, 0.0f, 0.01f);
+    TestEqual(TEXT("Outside of a loop"), Loop.Project(FVector(-10, 30, 0), 0.0f, 200.0f, &Lateral), 370.0f, 0.01f);
+    TestEqual(TEXT("Lateral offset outside of a loop"), Lateral, -10.0f, 0.01f);
+    TestEqual(TEXT("First segment of a loop"), Loop.Project(FVector(20, -5, 0), 390.0f, 200.0f), 20.0f, 0.01f);
+
+    // Round trip through Sample
+    FVector Location, Direction;
+    const float Distance = Open.Project(FVector(655, 12, 0), 700.0f, 2000.0f, &Lateral);
+    Open.Sample(Distance, Location, Direction);
+    TestTrue(TEXT("Sample plus the lateral offset gives the projected location back"),
+        (Location + FVector::CrossProduct(FVector::UpVector, Direction) * Lateral).Equals(FVector(655, 12, 0), 0.01f));
+
+    return true;
+}
+
+#endif
@@ -0,0 +1,177 @@
+#include "Tests/CityTestWorld.h"
+#include "Vehicles/VehicleBase.h"
+#include "Vehicles/VehicleEffectsSubsystem.h"
+#include "Vehicles/VehicleSignificanceSubsystem.h"
+#include "Components/AudioComponent.h"
+#include "NiagaraComponent.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Misc/AutomationTest.h"
+#include "HAL/PlatformTime.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // The cosmetic half of AVehicleBase::Tick from before UVehicleEffectsSubsystem, as it ran:
+    // one tick function per vehicle dispatched by the tick manager, reading the velocity in
+    // every stage that needs it and writing component parameters every frame
+    struct FLegacyVehicleCosmeticsTick : public FTickFunction
+    {
+        AVehicleBase* Vehicle = nullptr;
+        UAudioComponent* EngineAudio = nullptr;
+        UNiagaraComponent* ExhaustVFX = nullptr;
+        UNiagaraComponent* TireSmokeVFX = nullptr;
+        UNiagaraComponent* BrakeLightVFX = nullptr;
+        float CurrentThrottle = 0.0f;
+        float CurrentBrake = 0.0f;
+        float CurrentEngineRPM = 0.0f;
+        float LastSpeed = 0.0f;
+        float CameraShake = 0.0f;
+
+        virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override
+        {
+            // UpdateEngineSound
+            float Speed = Vehicle->GetVelocity().Size();
+            float TargetRPM = Vehicle->EngineIdleRPM + (Vehicle->MaxEngineRPM - Vehicle->EngineIdleRPM) * FMath::Abs(CurrentThrottle);
+            TargetRPM = FMath::Clamp(TargetRPM + Speed * 10.0f, Vehicle->EngineIdleRPM, Vehicle->MaxEngineRPM);
+            CurrentEngineRPM = FMath::FInterpTo(CurrentEngineRPM, TargetRPM, DeltaTime, 2.0f);
+            EngineAudio->SetFloatParameter(FName("RPM"), CurrentEngineRPM);
+            EngineAudio->SetFloatParameter(FName("Throttle"), FMath::Abs(CurrentThrottle));
+            EngineAudio->SetFloatParameter(FName("Speed"), Speed);
+
+            // UpdateExhaustVFX
+            const float ExhaustIntensity = FMath::Abs(CurrentThrottle) * Vehicle->ExhaustVFXIntensity;
+            if (ExhaustIntensity > 0.1f)
+            {
+                if (!ExhaustVFX->IsActive()) ExhaustVFX->Activate();
+                ExhaustVFX->SetFloatParameter(FName("Intensity"), ExhaustIntensity);
+            }
+            else if (ExhaustVFX->IsActive())
+            {
+                ExhaustVFX->Deactivate();
+            }
+
+            // UpdateTireSmoke
+            Speed = Vehicle->GetVelocity().Size();
+            const float Acceleration = (Speed - LastSpeed) / DeltaTime;
+            if (FMath::Abs(CurrentBrake) > Vehicle->TireSmokeThreshold || FMath::Abs(Acceleration) > 500.0f)
+            {
+                if (!TireSmokeVFX->IsActive()) TireSmokeVFX->Activate();
+            }
+            else if (TireSmokeVFX->IsActive())
+            {
+                TireSmokeVFX->Deactivate();
+            }
+            LastSpeed = Speed;
+
+            // UpdateBrakeLights
+            if (CurrentBrake > 0.1f)
+            {
+                if (!BrakeLightVFX->IsActive()) BrakeLightVFX->Activate();
+                BrakeLightVFX->SetFloatParameter(FName("Intensity"), Vehicle->BrakeLightIntensity * CurrentBrake);
+            }
+            else if (BrakeLightVFX->IsActive())
+            {
+                BrakeLightVFX->Deactivate();
+            }
+
+            // UpdateCameraEffects
+            Speed = Vehicle->GetVelocity().Size();
+            CameraShake = FMath::Clamp(Speed / 1000.0f, 0.0f, 0.1f);
+        }
+
+        virtual FString DiagnosticMessage() override
+        {
+            return FString::Printf(TEXT("FLegacyVehicleCosmeticsTick[%s]"), *GetNameSafe(Vehicle));
+        }
+    };
+}
+
+// 1,000 real vehicles in a test world: a frame with the old per-actor cosmetic ticks against a frame
+// with UVehicleEffectsSubsystem, each net of the same world ticking with no cosmetics at all
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVehicleEffectsCostTest, "BeLive.Vehicles.EffectsCost",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FVehicleEffectsCostTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 NumVehicles = 1000;
+    constexpr int32 NumFrames = 300;
+    constexpr int32 NumWarmupFrames = 10;
+    constexpr float DeltaTime = 1.0f / 60.0f;
+
+    FCityTestWorld TestWorld;
+    UWorld* World = TestWorld.GetWorld();
+    UVehicleEffectsSubsystem* EffectsSubsystem = World->GetSubsystem<UVehicleEffectsSubsystem>();
+    UVehicleSignificanceSubsystem* SignificanceSubsystem = World->GetSubsystem<UVehicleSignificanceSubsystem>();
+    if (!TestNotNull(TEXT("Effects subsystem"), EffectsSubsystem) || !TestNotNull(TEXT("Significance subsystem"), SignificanceSubsystem))
+    {
+        return false;
+    }
+
+    // Awake, full significance and held there: a test world has no camera to rank vehicles by
+    TArray<AVehicleBase*> Vehicles;
+    FRandomStream Stream(NumVehicles);
+    for (int32 Index = 0; Index < NumVehicles; ++Index)
+    {
+        const FTransform Transform(FVector((Index % 40) * 1000.0f, (Index / 40) * 1000.0f, 0.0f));
+        AVehicleBase* Vehicle = World->SpawnActorDeferred<AVehicleBase>(AVehicleBase::StaticClass(), Transform);
+        Vehicle->bStartAsleep = false;
+        Vehicle->FinishSpawning(Transform);
+        SignificanceSubsystem->UnregisterVehicle(Vehicle);
+        Vehicle->SetSignificance(EVehicleSignificance::High);
+
+        // The same inputs for both paths: throttle everywhere, some vehicles braking hard
+        Vehicle->CurrentThrottle = Stream.FRandRange(-1.0f, 1.0f);
+        Vehicle->CurrentBrake = Stream.FRand() < 0.2f ? 1.0f : 0.0f;
+        Vehicles.Add(Vehicle);
+    }
+    Vehicles[0]->CurrentThrottle = 1.0f;
+
+    auto TimeFrames = [&TestWorld]()
+    {
+        TestWorld.Tick(DeltaTime, NumWarmupFrames);
+        const uint64 Start = FPlatformTime::Cycles64();
+        TestWorld.Tick(DeltaTime, NumFrames);
+        return FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - Start) / NumFrames;
+    };
+
+    const double BatchedMs = TimeFrames();
+    TestTrue(TEXT("The subsystem updated the vehicles"), EffectsSubsystem->GetEngineRPM(Vehicles[0]) > Vehicles[0]->EngineIdleRPM);
+
+    for (AVehicleBase* Vehicle : Vehicles)
+    {
+        EffectsSubsystem->UnregisterVehicle(Vehicle);
+    }
+    const double NoCosmeticsMs = TimeFrames();
+
+    TArray<TUniquePtr<FLegacyVehicleCosmeticsTick>> LegacyTicks;
+    for (AVehicleBase* Vehicle : Vehicles)
+    {
+        FLegacyVehicleCosmeticsTick& Tick = *LegacyTicks.Add_GetRef(MakeUnique<FLegacyVehicleCosmeticsTick>());
+        Tick.Vehicle = Vehicle;
+        Tick.EngineAudio = Vehicle->EngineAudio;
+        Tick.ExhaustVFX = Vehicle->ExhaustVFX;
+        Tick.TireSmokeVFX = Vehicle->TireSmokeVFX;
+        Tick.BrakeLightVFX = Vehicle->BrakeLightVFX;
+        Tick.CurrentThrottle = Vehicle->CurrentThrottle;
+        Tick.CurrentBrake = Vehicle->CurrentBrake;
+        Tick.CurrentEngineRPM = Vehicle->EngineIdleRPM;
+        Tick.bCanEverTick = true;
+        Tick.TickGroup = TG_PrePhysics;
+        Tick.RegisterTickFunction(World->PersistentLevel);
+    }
+    const double PerActorMs = TimeFrames();
+    TestTrue(TEXT("The per-actor ticks ran"), LegacyTicks[0]->CurrentEngineRPM > Vehicles[0]->EngineIdleRPM);
+
+    for (const TUniquePtr<FLegacyVehicleCosmeticsTick>& Tick : LegacyTicks)
+    {
+        Tick->UnRegisterTickFunction();
+    }
+
+    AddInfo(FString::Printf(TEXT("%d vehicles, world tick: %.3f ms/frame without cosmetics, %.3f ms/frame with per-actor ticks (+%.3f), %.3f ms/frame with UVehicleEffectsSubsystem (+%.3f)"),
+        NumVehicles, NoCosmeticsMs, PerActorMs, PerActorMs - NoCosmeticsMs, BatchedMs, BatchedMs - NoCosmeticsMs));
+    return true;
+}
+
+#endif
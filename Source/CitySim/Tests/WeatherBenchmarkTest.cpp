@@ -0,0 +1,55 @@
+#include "Tests/CityTestWorld.h"
+#include "World/WeatherBenchmark.h"
+#include "World/WeatherTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Full simulated day for every weather type; writes the CSV and fails if any band or section was skipped.
+// Headless: -nullrhi -unattended -ExecCmds="Automation RunTests BeLive.Weather.Benchmark;Quit"
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeatherBenchmarkTest, "BeLive.Weather.Benchmark",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FWeatherBenchmarkTest::RunTest(const FString& Parameters)
+{
+    FCityTestWorld TestWorld;
+
+    FWeatherBenchmarkResult Result;
+    if (!TestTrue(TEXT("Benchmark ran and wrote its CSV"), FWeatherBenchmark::Run(TestWorld.GetWorld(), 1.0f / 60.0f, Result)))
+    {
+        return false;
+    }
+
+    TestTrue(TEXT("CSV exists"), FPaths::FileExists(Result.CsvPath));
+    TestTrue(FString::Printf(TEXT("Every weather type was simulated (mask 0x%x)"), Result.SeenWeather), Result.SawEveryWeather());
+    TestTrue(FString::Printf(TEXT("Every time of day band was visited (mask 0x%x)"), Result.SeenTimeOfDay), Result.SawEveryTimeOfDay());
+
+    for (int32 Index = 0; Index < static_cast<int32>(EWeatherProfileSection::Count); ++Index)
+    {
+        const TCHAR* Name = FWeatherBenchmark::GetSectionName(static_cast<EWeatherProfileSection>(Index));
+        TestEqual(FString::Printf(TEXT("%s timed once per step"), Name), Result.SectionCalls[Index], Result.Steps);
+    }
+    return true;
+}
+
+// Simulation step cost with and without the baked lighting table; informational, timings vary per machine
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeatherLightingTableCostTest, "BeLive.Weather.LightingTableCost",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FWeatherLightingTableCostTest::RunTest(const FString& Parameters)
+{
+    FCityTestWorld TestWorld;
+
+    double EvaluateStepUs = 0.0;
+    double TableStepUs = 0.0;
+    if (!TestTrue(TEXT("Comparison ran"), FWeatherBenchmark::CompareLightingTable(TestWorld.GetWorld(), 1.0f / 60.0f, EvaluateStepUs, TableStepUs)))
+    {
+        return false;
+    }
+
+    AddInfo(FString::Printf(TEXT("Mean simulation step: %.3f us with bUseBakedLightingTable off, %.3f us on"), EvaluateStepUs, TableStepUs));
+    return true;
+}
+
+#endif
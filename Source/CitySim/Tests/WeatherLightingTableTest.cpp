@@ -0,0 +1,77 @@
+#include "World/WeatherLightingTable.h"
+#include "World/WeatherManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    float GetLightingSampleDifference(const FWeatherLightingSample& A, const FWeatherLightingSample& B)
+    {
+        const FLinearColor SunColor = A.SunColor - B.SunColor;
+        const FLinearColor SkyColor = A.SkyColor - B.SkyColor;
+        return FMath::Max3(FMath::Abs(A.SunIntensity - B.SunIntensity),
+            FMath::Max3(FMath::Abs(SunColor.R), FMath::Abs(SunColor.G), FMath::Abs(SunColor.B)),
+            FMath::Max3(FMath::Abs(SkyColor.R), FMath::Abs(SkyColor.G), FMath::Abs(SkyColor.B)));
+    }
+}
+
+// The baked table against the piecewise day/night bands, with the weather manager's default lighting
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeatherLightingTableTest, "BeLive.Weather.LightingTable",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWeatherLightingTableTest::RunTest(const FString& Parameters)
+{
+    const AWeatherManager* Manager = GetDefault<AWeatherManager>();
+    FWeatherLightingBakeParams Params;
+    Params.SunIntensity = Manager->SunIntensity;
+    Params.SunColor = Manager->SunColor;
+    Params.SkyColor = Manager->SkyColor;
+
+    FWeatherLightingTable Table;
+    Table.Bake(Params);
+    if (!TestTrue(TEXT("Table baked"), Table.IsBaked()))
+    {
+        return false;
+    }
+
+    // A fine sweep, plus points just before, on and after every band edge
+    TArray<float> Times;
+    constexpr int32 NumSweepSamples = 10000;
+    for (int32 Index = 0; Index < NumSweepSamples; ++Index)
+    {
+        Times.Add(static_cast<float>(Index) / NumSweepSamples);
+    }
+    TArray<float, TInlineAllocator<8>> Edges;
+    FWeatherLightingTable::GetBandEdges(Params, Edges);
+    TestTrue(TEXT("Built-in bands have edges"), Edges.Num() > 0);
+    for (const float Edge : Edges)
+    {
+        Times.Append({ Edge - 1.0e-4f, Edge, Edge + 1.0e-4f });
+    }
+
+    // The documented interpolation error; steps across band edges must come through unblurred
+    const float Tolerance = 1.0e-3f * FMath::Max(Params.SunIntensity, 1.0f);
+    for (int32 W = 0; W < NumWeatherTypes; ++W)
+    {
+        const EWeatherType Weather = static_cast<EWeatherType>(W);
+
+        float WorstDifference = 0.0f;
+        float WorstTime = 0.0f;
+        for (const float T : Times)
+        {
+            const float Difference = GetLightingSampleDifference(Table.Sample(T, Weather), FWeatherLightingTable::Evaluate(T, Weather, Params));
+            if (Difference > WorstDifference)
+            {
+                WorstDifference = Difference;
+                WorstTime = T;
+            }
+        }
+
+        TestTrue(FString::Printf(TEXT("%s: worst difference %.6f at T=%.4f within %.6f"),
+            *UEnum::GetDisplayValueAsText(Weather).ToString(), WorstDifference, WorstTime, Tolerance), WorstDifference <= Tolerance);
+    }
+    return true;
+}
+
+#endif
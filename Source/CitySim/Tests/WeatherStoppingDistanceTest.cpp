@@ -0,0 +1,113 @@
+#include "Tests/CityTestWorld.h"
+#include "Vehicles/VehicleBase.h"
+#include "Vehicles/FixedStepVehicleMovementComponent.h"
+#include "World/WeatherManager.h"
+#include "World/WeatherSubsystem.h"
+#include "ChaosVehicleWheel.h"
+#include "Engine/World.h"
+#include "Engine/DirectionalLight.h"
+#include "Engine/SkyAtmosphere.h"
+#include "Engine/ExponentialHeightFog.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr float DeltaTime = 1.0f / 60.0f;
+    constexpr float BrakeFromSpeed = 2000.0f; // cm/s, 72 km/h
+    constexpr float StoppedSpeed = 10.0f;
+    constexpr float MaxBrakeTime = 15.0f;
+
+    // Spawns a vehicle, lets it settle on the floor and sends Weather through the weather
+    // subsystem as the manager would. Checks what reached each wheel's simulation, then brakes
+    // from BrakeFromSpeed and returns the distance to a stop in cm.
+    float StopUnder(FAutomationTestBase& Test, FCityTestWorld& TestWorld, UClass* VehicleClass, EWeatherType Weather)
+    {
+        UWorld* World = TestWorld.GetWorld();
+        const FTransform Transform(FVector(0.0f, 0.0f, 50.0f));
+        AVehicleBase* Vehicle = World->SpawnActorDeferred<AVehicleBase>(VehicleClass, Transform);
+        Vehicle->bStartAsleep = false;
+        Vehicle->FinishSpawning(Transform);
+        TestWorld.Tick(DeltaTime, 60);
+
+        UWeatherSubsystem* WeatherSubsystem = World->GetSubsystem<UWeatherSubsystem>();
+        WeatherSubsystem->OnWeatherTypeChanged.Broadcast(Weather);
+
+        // The floor is the default surface: each wheel's authored friction times the baked cell
+        const FString WeatherName = UEnum::GetDisplayValueAsText(Weather).ToString();
+        const float Grip = WeatherSubsystem->GetWeatherManager()->GetFrictionTable().GetMultiplier(SurfaceType_Default, Weather);
+        const UFixedStepVehicleMovementComponent* Movement = Cast<UFixedStepVehicleMovementComponent>(Vehicle->GetVehicleMovementComponent());
+        if (Test.TestNotNull(TEXT("Vehicle movement component"), Movement))
+        {
+            Test.TestTrue(TEXT("Vehicle has wheels"), Movement->GetNumWheels() > 0);
+            for (int32 Wheel = 0; Wheel < Movement->GetNumWheels(); ++Wheel)
+            {
+                const float Expected = Movement->Wheels[Wheel]->FrictionForceMultiplier * Grip;
+                Test.TestEqual(*FString::Printf(TEXT("%s friction multiplier on wheel %d"), *WeatherName, Wheel),
+                    Movement->GetSimulatedWheelFrictionMultiplier(Wheel), Expected, 1.0e-4f);
+            }
+        }
+
+        // Launched with its wheels still and the brake held, so the stop is limited by grip
+        // rather than brake torque. Measured to standstill; the brake reverses after that.
+        const FVector Start = Vehicle->GetActorLocation();
+        Vehicle->WakeUp();
+        Vehicle->GetMesh()->SetAllPhysicsLinearVelocity(Vehicle->GetActorForwardVector() * BrakeFromSpeed);
+
+        FVehicleInputFrame Brake;
+        Brake.Brake = 1.0f;
+        float Time = 0.0f;
+        do
+        {
+            Vehicle->SetInputFrame(Brake);
+            TestWorld.Tick(DeltaTime);
+            Time += DeltaTime;
+        }
+        while (Vehicle->GetVelocity().Size2D() > StoppedSpeed && Time < MaxBrakeTime);
+        Test.TestTrue(*FString::Printf(TEXT("%s stops within %.0f s"), *WeatherName, MaxBrakeTime), Time < MaxBrakeTime);
+
+        const float Distance = FVector::Dist2D(Start, Vehicle->GetActorLocation());
+        Vehicle->Destroy();
+        return Distance;
+    }
+}
+
+// Weather grip from the baked table, through the friction subsystem, into the wheel simulation,
+// and out as a longer stop in heavy rain than in clear weather
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FWeatherStoppingDistanceTest, "BeLive.Vehicles.WeatherStoppingDistance",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FWeatherStoppingDistanceTest::RunTest(const FString& Parameters)
+{
+    UClass* VehicleClass = FCityTestWorld::LoadVehicleClass(*this);
+    if (!VehicleClass) return false;
+
+    // Synchronous physics, so the wheels' friction can be read back on the game thread
+    FCityTestWorld TestWorld;
+    UWorld* World = TestWorld.GetWorld();
+    TestWorld.SpawnFloor();
+
+    // Only here for its grip table; left to itself it would change the weather on its own
+    AWeatherManager* Manager = World->SpawnActorDeferred<AWeatherManager>(AWeatherManager::StaticClass(), FTransform::Identity);
+    Manager->bEnableDynamicWeather = false;
+    Manager->Sun = World->SpawnActor<ADirectionalLight>();
+    Manager->SkyAtmosphere = World->SpawnActor<ASkyAtmosphere>();
+    Manager->HeightFog = World->SpawnActor<AExponentialHeightFog>();
+    Manager->FinishSpawning(FTransform::Identity);
+
+    const FRoadFrictionTable& Table = Manager->GetFrictionTable();
+    TestTrue(TEXT("Heavy rain grips less than clear in the baked table"),
+        Table.GetMultiplier(SurfaceType_Default, EWeatherType::HeavyRain) < Table.GetMultiplier(SurfaceType_Default, EWeatherType::Clear));
+
+    const float ClearDistance = StopUnder(*this, TestWorld, VehicleClass, EWeatherType::Clear);
+    const float RainDistance = StopUnder(*this, TestWorld, VehicleClass, EWeatherType::HeavyRain);
+    AddInfo(FString::Printf(TEXT("Stopping from %.0f km/h: clear %.1f m, heavy rain %.1f m"),
+        BrakeFromSpeed * 0.036f, ClearDistance / 100.0f, RainDistance / 100.0f));
+
+    // Well clear of solver noise; the default wet grip makes it far longer than this
+    TestTrue(TEXT("Heavy rain stops at least 5% longer than clear"), RainDistance > ClearDistance * 1.05f);
+    return true;
+}
+
+#endif
@@ -1 +1,100 @@
 #include "Vehicles/CarVehicle.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/PlatformTime.h"
+#include "Serialization/ArchiveCountMem.h"
+
+namespace
+{
+    struct FCarFootprint
+    {
+        int32 Components = 0;
+        int64 ObjectBytes = 0;
+        int64 ResourceBytes = 0;
+    };
+
+    // Object memory as memreport's obj list counts it, plus the exclusive resource size, over
+    // the vehicles and all of their components
+    FCarFootprint MeasureFootprint(const TArray<ACarVehicle*>& Cars)
+    {
+        FCarFootprint Footprint;
+        auto Count = [&Footprint](UObject* Object)
+        {
+            FArchiveCountMem CountMem(Object);
+            Footprint.ObjectBytes += CountMem.GetMax();
+            Footprint.ResourceBytes += Object->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+        };
+
+        TArray<UActorComponent*> Components;
+        for (ACarVehicle* Car : Cars)
+        {
+            Car->GetComponents(Components);
+            Footprint.Components += Components.Num();
+            Count(Car);
+            for (UActorComponent* Component : Components)
+            {
+                Count(Component);
+            }
+        }
+        return Footprint;
+    }
+}
+
+static FAutoConsoleCommandWithWorldAndArgs VehicleSpawnFootprintCommand(
+    TEXT("Vehicle.SpawnFootprint"),
+    TEXT("Spawns Count cars in the current world and logs spawn time and memory per car, undriven and with the driver-only components every car used to build at spawn. Usage: Vehicle.SpawnFootprint [Count=500]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (!World) return;
+
+        const int32 Count = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 500;
+        TArray<ACarVehicle*> Cars;
+        Cars.Reserve(Count);
+
+        FActorSpawnParameters SpawnInfo;
+        SpawnInfo.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        SpawnInfo.ObjectFlags |= RF_Transient;
+
+        // Spread out well above the level; the cars are gone again before the next tick
+        const uint64 UsedBeforeSpawn = FPlatformMemory::GetStats().UsedPhysical;
+        const uint64 SpawnStart = FPlatformTime::Cycles64();
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const FVector Location((Index % 25) * 1000.0f, (Index / 25) * 1000.0f, 100000.0f);
+            if (ACarVehicle* Car = World->SpawnActor<ACarVehicle>(Location, FRotator::ZeroRotator, SpawnInfo))
+            {
+                Cars.Add(Car);
+            }
+        }
+        const double SpawnMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SpawnStart);
+        const uint64 UsedAfterSpawn = FPlatformMemory::GetStats().UsedPhysical;
+        const FCarFootprint Undriven = MeasureFootprint(Cars);
+
+        // Entering builds the camera rig, driver audio and turn-signal VFX, which is the layout
+        // every car had before they moved out of the constructor
+        const uint64 EnterStart = FPlatformTime::Cycles64();
+        for (ACarVehicle* Car : Cars)
+        {
+            Car->OnEnteredVehicle(nullptr);
+        }
+        const double EnterMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - EnterStart);
+        const uint64 UsedAfterEnter = FPlatformMemory::GetStats().UsedPhysical;
+        const FCarFootprint Driven = MeasureFootprint(Cars);
+
+        for (ACarVehicle* Car : Cars)
+        {
+            Car->OnExitedVehicle(nullptr);
+            Car->Destroy();
+        }
+
+        const double PerCar = 1.0 / FMath::Max(Cars.Num(), 1);
+        const double SpawnedKB = (double)(int64)(UsedAfterSpawn - UsedBeforeSpawn) / 1024.0;
+        const double EnteredKB = (double)(int64)(UsedAfterEnter - UsedBeforeSpawn) / 1024.0;
+        UE_LOG(LogTemp, Log, TEXT("Vehicle.SpawnFootprint: %d cars, spawn %.3f ms per car, driver components %.3f ms per car"),
+            Cars.Num(), SpawnMs * PerCar, EnterMs * PerCar);
+        UE_LOG(LogTemp, Log, TEXT("  Undriven:               %.1f components, objects %.1f KB, resources %.1f KB, physical %.1f KB per car"),
+            Undriven.Components * PerCar, Undriven.ObjectBytes * PerCar / 1024.0, Undriven.ResourceBytes * PerCar / 1024.0, SpawnedKB * PerCar);
+        UE_LOG(LogTemp, Log, TEXT("  With driver components: %.1f components, objects %.1f KB, resources %.1f KB, physical %.1f KB per car"),
+            Driven.Components * PerCar, Driven.ObjectBytes * PerCar / 1024.0, Driven.ResourceBytes * PerCar / 1024.0, EnteredKB * PerCar);
+    }));
@@ -0,0 +1,97 @@
+#include "Vehicles/FixedStepVehicleMovementComponent.h"
+#include "Engine/World.h"
+#include "Physics/Experimental/PhysScene_Chaos.h"
+#include "PBDRigidsSolver.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+
+// Rise and fall rate that lets Chaos' game-thread input rate limiting pass values straight through
+static constexpr float InstantInputRate = 1.0e6f;
+
+// Input stamped this little after a step's start still counts as sent before it
+static constexpr double InputTimeTolerance = 1.0e-4;
+
+void FFixedStepVehicleSimulation::ApplyInput(const FControlInputs& ControlInputs, float DeltaTime)
+{
+    // Steps that run late don't pick up input the game thread sent after their time
+    const double StepTime = Solver->GetSolverTime();
+    for (const FTimedVehicleInput* Next = InputQueue.Peek(); Next && Next->Time <= StepTime + InputTimeTolerance; Next = InputQueue.Peek())
+    {
+        if (Next->bReset)
+        {
+            Current = FVehicleInputFrame();
+        }
+        Target = Next->Input;
+        InputQueue.Pop();
+    }
+    Smoothing.Step(Current, Target, DeltaTime);
+
+    FControlInputs Smoothed = ControlInputs;
+    Smoothed.ThrottleInput = Current.Throttle;
+    Smoothed.SteeringInput = Current.Steer;
+    Smoothed.BrakeInput = Current.Brake;
+    UChaosWheeledVehicleSimulation::ApplyInput(Smoothed, DeltaTime);
+}
+
+TUniquePtr<Chaos::FSimpleWheeledVehicle> UFixedStepVehicleMovementComponent::CreatePhysicsVehicle()
+{
+    // Without async physics there is one physics step per frame, so per-frame smoothing already matches it
+    const AVehicleBase* Vehicle = Cast<AVehicleBase>(GetOwner());
+    const FPhysScene* Scene = GetWorld()->GetPhysicsScene();
+    bSmoothPerPhysicsStep = Vehicle && Vehicle->bFixedStepInput && Scene && UPhysicsSettings::Get()->bTickPhysicsAsync;
+    bInputQueued = false;
+    if (!bSmoothPerPhysicsStep)
+    {
+        return Super::CreatePhysicsVehicle();
+    }
+
+    // Chaos rate-limits input once per game frame before sending it; that would put the frame rate back in
+    for (FVehicleInputRateConfig* Rate : { &ThrottleInputRate, &BrakeInputRate, &SteeringInputRate, &HandbrakeInputRate })
+    {
+        Rate->RiseRate = InstantInputRate;
+        Rate->FallRate = InstantInputRate;
+    }
+
+    // Same as the base class, with our simulation in place of the stock one
+    VehicleSimulationPT = MakeUnique<FFixedStepVehicleSimulation>(Vehicle->GetInputSmoothing(), Scene->GetSolver());
+    return UChaosVehicleMovementComponent::CreatePhysicsVehicle();
+}
+
+void UFixedStepVehicleMovementComponent::UpdateState(float DeltaTime)
+{
+    Super::UpdateState(DeltaTime);
+
+    FFixedStepVehicleSimulation* Simulation = bSmoothPerPhysicsStep ? static_cast<FFixedStepVehicleSimulation*>(VehicleSimulationPT.Get()) : nullptr;
+    if (!Simulation) return;
+
+    // Throttle and brake as Chaos resolved them from the raw input, reverse-as-brake included
+    FVehicleInputFrame Input;
+    Input.Throttle = ThrottleInput;
+    Input.Steer = SteeringInput;
+    Input.Brake = BrakeInput;
+    Input.bHandbrake = HandbrakeInput > 0.5f;
+    if (bInputQueued && Input == QueuedInput && !bResetPending) return;
+
+    // Runs before this frame's physics steps are dispatched, so they all start at or after this time
+    FTimedVehicleInput Timed;
+    Timed.Time = GetWorld()->GetPhysicsScene()->GetSolver()->GetMarshallingManager().GetExternalTime_External();
+    Timed.Input = Input;
+    Timed.bReset = bResetPending;
+    Simulation->QueueInput(Timed);
+    QueuedInput = Input;
+    bInputQueued = true;
+    bResetPending = false;
+}
+
+float UFixedStepVehicleMovementComponent::GetSimulatedWheelFrictionMultiplier(int32 Wheel) const
+{
+    const UChaosWheeledVehicleSimulation* Simulation = static_cast<const UChaosWheeledVehicleSimulation*>(VehicleSimulationPT.Get());
+    if (!Simulation || !Simulation->PVehicle || !Simulation->PVehicle->Wheels.IsValidIndex(Wheel)) return 1.0f;
+
+    return Simulation->PVehicle->Wheels[Wheel].FrictionMultiplier;
+}
+
+void UFixedStepVehicleMovementComponent::ResetInput()
+{
+    // A vehicle released to the pool stops stepping; the reset waits in the queue until it is back
+    bResetPending = bSmoothPerPhysicsStep;
+}
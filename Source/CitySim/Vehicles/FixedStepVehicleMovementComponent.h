@@ -0,0 +1,77 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "ChaosWheeledVehicleMovementComponent.h"
+#include "Containers/Queue.h"
+#include "Vehicles/VehicleBase.h"
+#include "FixedStepVehicleMovementComponent.generated.h"
+
+namespace Chaos { class FPBDRigidsSolver; }
+
+// Input as the game thread sent it, stamped with the physics time it had dispatched up to
+struct FTimedVehicleInput
+{
+    double Time = 0.0;
+    FVehicleInputFrame Input;
+    bool bReset = false; // Start smoothing again from rest rather than from the last driver's input
+};
+
+// Wheeled vehicle simulation that smooths the driver's input itself, once per physics step and
+// with that step's delta time. The game thread queues its input stamped with physics time, and
+// each step applies the latest input stamped at or before the step's start, however far the
+// physics thread runs behind the game thread.
+class FFixedStepVehicleSimulation : public UChaosWheeledVehicleSimulation
+{
+public:
+    FFixedStepVehicleSimulation(const FVehicleInputSmoothing& InSmoothing, const Chaos::FPBDRigidsSolver* InSolver)
+        : Smoothing(InSmoothing)
+        , Solver(InSolver)
+    {
+    }
+
+    // Game thread only
+    void QueueInput(const FTimedVehicleInput& Input) { InputQueue.Enqueue(Input); }
+
+    virtual void ApplyInput(const FControlInputs& ControlInputs, float DeltaTime) override;
+
+private:
+    FVehicleInputSmoothing Smoothing;
+    const Chaos::FPBDRigidsSolver* Solver = nullptr;
+    TQueue<FTimedVehicleInput, EQueueMode::Spsc> InputQueue;
+
+    // Physics thread only
+    FVehicleInputFrame Target;
+    FVehicleInputFrame Current;
+};
+
+// Movement component for AVehicleBase. With bFixedStepInput and async physics, input smoothing
+// moves to the physics thread so every physics step sees its own input, however many steps run
+// in a frame. Otherwise it behaves exactly like UChaosWheeledVehicleMovementComponent.
+UCLASS()
+class BELIVE_API UFixedStepVehicleMovementComponent : public UChaosWheeledVehicleMovementComponent
+{
+    GENERATED_BODY()
+
+public:
+    // Whether this vehicle's input is smoothed per physics step; decided when physics is created
+    bool IsSmoothingPerPhysicsStep() const { return bSmoothPerPhysicsStep; }
+
+    // Drops the physics thread's smoothed input along with the next queued input, so whoever
+    // drives next starts from rest
+    void ResetInput();
+
+    // Friction multiplier the physics simulation holds for Wheel, as SetWheelFrictionMultiplier
+    // left it. Physics thread state, so only safe to read from the game thread with synchronous physics.
+    float GetSimulatedWheelFrictionMultiplier(int32 Wheel) const;
+
+protected:
+    virtual TUniquePtr<Chaos::FSimpleWheeledVehicle> CreatePhysicsVehicle() override;
+    virtual void UpdateState(float DeltaTime) override;
+
+private:
+    bool bSmoothPerPhysicsStep = false;
+
+    // Last input queued for the physics thread; unchanged input isn't queued again
+    FVehicleInputFrame QueuedInput;
+    bool bInputQueued = false;
+    bool bResetPending = false;
+};
@@ -0,0 +1,125 @@
+#include "Vehicles/SkidMarkManager.h"
+#include "Vehicles/VehicleEffectsSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+
+DECLARE_CYCLE_STAT(TEXT("Skid Mark Flush"), STAT_SkidMarkFlush, STATGROUP_Vehicles);
+
+void FSkidMarkRing::Init(int32 Capacity)
+{
+    Marks.Init(FTransform(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector), FMath::Max(Capacity, 0));
+    Next = 0;
+    Count = 0;
+    DirtyFirst = 0;
+    DirtyCount = 0;
+}
+
+int32 FSkidMarkRing::Add(const FTransform& Mark)
+{
+    if (Marks.Num() == 0) return INDEX_NONE;
+
+    const int32 Slot = Next;
+    Marks[Slot] = Mark;
+    Next = (Next + 1) % Marks.Num();
+    Count = FMath::Min(Count + 1, Marks.Num());
+
+    if (DirtyCount == 0)
+    {
+        DirtyFirst = Slot;
+    }
+    DirtyCount = FMath::Min(DirtyCount + 1, Marks.Num());
+    return Slot;
+}
+
+int32 FSkidMarkRing::ConsumeDirtyRanges(int32 OutFirst[2], int32 OutCount[2])
+{
+    int32 NumRanges = 0;
+    if (DirtyCount > 0 && DirtyCount >= Marks.Num())
+    {
+        // Lapped the whole ring since the last call
+        OutFirst[0] = 0;
+        OutCount[0] = Marks.Num();
+        NumRanges = 1;
+    }
+    else if (DirtyCount > 0)
+    {
+        const int32 FirstRun = FMath::Min(DirtyCount, Marks.Num() - DirtyFirst);
+        OutFirst[0] = DirtyFirst;
+        OutCount[0] = FirstRun;
+        NumRanges = 1;
+        if (DirtyCount > FirstRun)
+        {
+            OutFirst[1] = 0;
+            OutCount[1] = DirtyCount - FirstRun;
+            NumRanges = 2;
+        }
+    }
+
+    DirtyCount = 0;
+    return NumRanges;
+}
+
+ASkidMarkManager::ASkidMarkManager()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+
+    // Purely visual: no collision, navigation or shadows
+    Marks = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("Marks"));
+    Marks->SetupAttachment(RootComponent);
+    Marks->SetMobility(EComponentMobility::Movable);
+    Marks->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Marks->SetGenerateOverlapEvents(false);
+    Marks->SetCanEverAffectNavigation(false);
+    Marks->SetCastShadow(false);
+}
+
+void ASkidMarkManager::BeginPlay()
+{
+    Super::BeginPlay();
+
+    // Every instance exists from the start; laying a mark only rewrites a transform
+    Ring.Init(Capacity);
+    Marks->ClearInstances();
+    Marks->AddInstances(Ring.GetMarks(), false, true);
+
+    if (UVehicleEffectsSubsystem* EffectsSubsystem = GetWorld()->GetSubsystem<UVehicleEffectsSubsystem>())
+    {
+        EffectsSubsystem->RegisterSkidMarkManager(this);
+    }
+}
+
+void ASkidMarkManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UVehicleEffectsSubsystem* EffectsSubsystem = GetWorld()->GetSubsystem<UVehicleEffectsSubsystem>())
+    {
+        EffectsSubsystem->UnregisterSkidMarkManager(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void ASkidMarkManager::AddSegment(const FVector& Start, const FVector& End, const FVector& Up)
+{
+    // Stretched along the direction of travel, centred between the two contact points
+    const FVector Delta = End - Start;
+    const FQuat Rotation = FRotationMatrix::MakeFromXZ(Delta, Up).ToQuat();
+    const FVector Scale(Delta.Size() / MeshLength, MarkWidth / MeshWidth, 1.0f);
+    Ring.Add(FTransform(Rotation, (Start + End) * 0.5f + Up * SurfaceOffset, Scale));
+}
+
+void ASkidMarkManager::FlushMarks()
+{
+    SCOPE_CYCLE_COUNTER(STAT_SkidMarkFlush);
+
+    int32 First[2];
+    int32 Count[2];
+    const int32 NumRanges = Ring.ConsumeDirtyRanges(First, Count);
+    for (int32 Range = 0; Range < NumRanges; ++Range)
+    {
+        Scratch.Reset();
+        Scratch.Append(&Ring.GetMarks()[First[Range]], Count[Range]);
+        Marks->BatchUpdateInstancesTransforms(First[Range], Scratch, true, Range == NumRanges - 1, false);
+    }
+}
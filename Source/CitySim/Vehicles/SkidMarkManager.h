@@ -0,0 +1,97 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SkidMarkManager.generated.h"
+
+class UInstancedStaticMeshComponent;
+
+// Fixed-capacity ring of skid mark transforms; once full, each new mark overwrites the oldest.
+// Slots map one to one onto mesh instances, and unused slots are zero-scaled. Touches no
+// UObjects, so it can be exercised without a world (see BeLive.Vehicles.SkidMarkRing).
+struct FSkidMarkRing
+{
+    void Init(int32 Capacity);
+
+    // Slot the mark went into, or INDEX_NONE with no capacity
+    int32 Add(const FTransform& Mark);
+
+    int32 GetCapacity() const { return Marks.Num(); }
+    int32 Num() const { return Count; }
+    int32 GetOldest() const { return Count < Marks.Num() ? 0 : Next; }
+    const TArray<FTransform>& GetMarks() const { return Marks; }
+
+    // Runs of slots written since the last call, in slot order. At most two, since the writes
+    // wrap around the end once at most; returns how many were filled in.
+    int32 ConsumeDirtyRanges(int32 OutFirst[2], int32 OutCount[2]);
+
+private:
+    TArray<FTransform> Marks;
+    int32 Next = 0;
+    int32 Count = 0;
+    int32 DirtyFirst = 0;
+    int32 DirtyCount = 0;
+};
+
+// Last mark end of each wheel of one vehicle; unset while that wheel isn't leaving a mark
+struct FSkidMarkTrail
+{
+    TArray<TOptional<FVector>, TInlineAllocator<4>> LastPoint;
+
+    void Reset() { LastPoint.Reset(); }
+};
+
+// Persistent skid marks for every vehicle, drawn by one instanced mesh with a fixed number of
+// instances; place one per level. UVehicleEffectsSubsystem lays a segment under each wheel of a
+// vehicle showing tire smoke, and the oldest marks are recycled first, so the cost is the same
+// however many vehicles are sliding.
+UCLASS()
+class BELIVE_API ASkidMarkManager : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ASkidMarkManager();
+
+    // Set a flat mark mesh lying along +X, and its decal-like material, on this
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UInstancedStaticMeshComponent* Marks = nullptr;
+
+    // Marks kept before the oldest are reused
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skid Marks", meta = (ClampMin = "1"))
+    int32 Capacity = 2048;
+
+    // Size of the mark mesh in cm at scale 1, along X and Y
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skid Marks", meta = (ClampMin = "1"))
+    float MeshLength = 100.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skid Marks", meta = (ClampMin = "1"))
+    float MeshWidth = 100.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skid Marks", meta = (ClampMin = "1"))
+    float MarkWidth = 25.0f;
+
+    // A wheel has to travel this far before its next segment is laid
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skid Marks", meta = (ClampMin = "1"))
+    float MinSegmentLength = 50.0f;
+
+    // Longer jumps (teleports, skipped updates) start a new trail instead of bridging the gap
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skid Marks", meta = (ClampMin = "1"))
+    float MaxSegmentLength = 400.0f;
+
+    // Lift off the road surface against z-fighting
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Skid Marks")
+    float SurfaceOffset = 1.0f;
+
+    void AddSegment(const FVector& Start, const FVector& End, const FVector& Up);
+
+    // Sends the marks added since the last flush to the instanced mesh
+    void FlushMarks();
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+    FSkidMarkRing Ring;
+    TArray<FTransform> Scratch;
+};
@@ -0,0 +1,33 @@
+#include "Vehicles/TrafficLane.h"
+#include "Vehicles/TrafficSubsystem.h"
+#include "Components/SplineComponent.h"
+#include "Engine/World.h"
+
+ATrafficLane::ATrafficLane()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    Spline = CreateDefaultSubobject<USplineComponent>(TEXT("Spline"));
+    Spline->SetMobility(EComponentMobility::Static);
+    RootComponent = Spline;
+}
+
+void ATrafficLane::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UTrafficSubsystem* TrafficSubsystem = GetWorld()->GetSubsystem<UTrafficSubsystem>())
+    {
+        TrafficSubsystem->RegisterLane(this);
+    }
+}
+
+void ATrafficLane::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UTrafficSubsystem* TrafficSubsystem = GetWorld()->GetSubsystem<UTrafficSubsystem>())
+    {
+        TrafficSubsystem->UnregisterLane(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "TrafficLane.generated.h"
+
+// One-way lane that ambient traffic follows in spline direction. Baked into a polyline by the
+// traffic subsystem at BeginPlay, so the spline is not edited at runtime. Traffic reaching the
+// end of an open lane reappears at its start; close the loop or keep lane ends out of sight.
+UCLASS()
+class BELIVE_API ATrafficLane : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ATrafficLane();
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    class USplineComponent* Spline = nullptr;
+
+    // cm/s; individual vehicles drive a little above or below it
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Traffic", meta = (ClampMin = "0"))
+    float SpeedLimit = 1400.0f;
+
+    // Vehicles spread along the lane when traffic starts
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Traffic", meta = (ClampMin = "0"))
+    int32 NumVehicles = 10;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
@@ -0,0 +1,47 @@
+#include "Vehicles/TrafficManager.h"
+#include "Vehicles/TrafficSubsystem.h"
+#include "Vehicles/CarVehicle.h"
+#include "Vehicles/BikeVehicle.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+
+static UInstancedStaticMeshComponent* CreateProxyInstances(AActor* Owner, const FName& Name)
+{
+    // Purely visual: no collision, no physics, no navigation
+    UInstancedStaticMeshComponent* Instances = Owner->CreateDefaultSubobject<UInstancedStaticMeshComponent>(Name);
+    Instances->SetupAttachment(Owner->GetRootComponent());
+    Instances->SetMobility(EComponentMobility::Movable);
+    Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Instances->SetGenerateOverlapEvents(false);
+    Instances->SetCanEverAffectNavigation(false);
+    return Instances;
+}
+
+ATrafficManager::ATrafficManager()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+    CarInstances = CreateProxyInstances(this, TEXT("CarInstances"));
+    BikeInstances = CreateProxyInstances(this, TEXT("BikeInstances"));
+}
+
+void ATrafficManager::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UTrafficSubsystem* TrafficSubsystem = GetWorld()->GetSubsystem<UTrafficSubsystem>())
+    {
+        TrafficSubsystem->RegisterTrafficManager(this);
+    }
+}
+
+void ATrafficManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UTrafficSubsystem* TrafficSubsystem = GetWorld()->GetSubsystem<UTrafficSubsystem>())
+    {
+        TrafficSubsystem->UnregisterTrafficManager(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "TrafficManager.generated.h"
+
+class ACarVehicle;
+class ABikeVehicle;
+class UInstancedStaticMeshComponent;
+
+// Settings and instanced meshes for ambient traffic; place one per level. The simulation
+// itself runs in UTrafficSubsystem. Distant traffic is kinematic and drawn through the two
+// instanced mesh components; vehicles near the player are swapped for pooled Chaos vehicles.
+UCLASS()
+class BELIVE_API ATrafficManager : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ATrafficManager();
+
+    // Proxy rendering; set the car and bike meshes on these
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UInstancedStaticMeshComponent* CarInstances = nullptr;
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    UInstancedStaticMeshComponent* BikeInstances = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Traffic")
+    TSubclassOf<ACarVehicle> CarClass;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Traffic")
+    TSubclassOf<ABikeVehicle> BikeClass;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Traffic", meta = (ClampMin = "0", ClampMax = "1"))
+    float BikeFraction = 0.15f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Traffic")
+    int32 RandomSeed = 1;
+
+    // Proxies closer than this to the player become real vehicles
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Handoff", meta = (ClampMin = "0"))
+    float PromoteRadius = 6000.0f;
+
+    // Real vehicles further than this go back to being proxies; keep it above PromoteRadius
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Handoff", meta = (ClampMin = "0"))
+    float DemoteRadius = 7500.0f;
+
+    // Vehicles spawned up front; at most this many of each kind are real at once
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Handoff", meta = (ClampMin = "0"))
+    int32 CarPoolSize = 12;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Handoff", meta = (ClampMin = "0"))
+    int32 BikePoolSize = 4;
+
+    // Car following: bumper gap at standstill, seconds of headway at speed, cm/s² limits
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Driving", meta = (ClampMin = "0"))
+    float MinGap = 700.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Driving", meta = (ClampMin = "0"))
+    float TimeHeadway = 1.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Driving", meta = (ClampMin = "0"))
+    float MaxAcceleration = 300.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Driving", meta = (ClampMin = "0"))
+    float MaxDeceleration = 900.0f;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
@@ -0,0 +1,651 @@
+#include "Vehicles/TrafficSubsystem.h"
+#include "Vehicles/TrafficLane.h"
+#include "Vehicles/TrafficManager.h"
+#include "Vehicles/VehicleBase.h"
+#include "ActorPoolSubsystem.h"
+#include "Components/SplineComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Kismet/GameplayStatics.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+DECLARE_CYCLE_STAT(TEXT("Traffic Simulate"), STAT_TrafficSimulate, STATGROUP_Vehicles);
+DECLARE_CYCLE_STAT(TEXT("Traffic Drive Promoted"), STAT_TrafficDrivePromoted, STATGROUP_Vehicles);
+DECLARE_CYCLE_STAT(TEXT("Traffic Handoff"), STAT_TrafficHandoff, STATGROUP_Vehicles);
+DECLARE_CYCLE_STAT(TEXT("Traffic Instances"), STAT_TrafficInstances, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Traffic Proxies"), STAT_TrafficProxies, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Traffic Promoted"), STAT_TrafficPromoted, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Traffic Pool Misses"), STAT_TrafficPoolMisses, STATGROUP_Vehicles);
+
+static TAutoConsoleVariable<bool> CVarTrafficParallel(
+    TEXT("Traffic.Parallel"), true,
+    TEXT("Spread the traffic proxy simulation across worker threads."));
+
+static TAutoConsoleVariable<float> CVarTrafficHandoffInterval(
+    TEXT("Traffic.HandoffInterval"), 0.25f,
+    TEXT("Seconds between checks for traffic proxies to promote to real vehicles or demote back."));
+
+// Proxies per ParallelFor batch
+static constexpr int32 TrafficBatchSize = 256;
+
+// Lane bake resolution, and how far a promoted vehicle is searched for along its lane each frame
+static constexpr float LaneSampleSpacing = 100.0f;
+static constexpr float LaneProjectWindow = 2000.0f;
+
+// Promoted vehicles on an open lane are demoted this close to its end, before they run out of road
+static constexpr float LaneEndMargin = 1000.0f;
+
+// Seconds for a demoted vehicle's offset from the lane center to fall to 1/e
+static constexpr float LateralReturnTime = 2.0f;
+
+// Lane following for promoted vehicles: look-ahead distance, steering angle for full lock, and
+// the speed error (cm/s) that gives full throttle or brake
+static constexpr float MinLookAhead = 800.0f;
+static constexpr float FullSteerAngle = UE_PI * 0.25f;
+static constexpr float FullPedalSpeedError = 500.0f;
+
+// Horizontal right-hand vector for a lane direction
+static FVector LaneRight(const FVector& Direction)
+{
+    return FVector::CrossProduct(FVector::UpVector, Direction).GetSafeNormal();
+}
+
+float FTrafficLanePath::WrapDistance(float Distance) const
+{
+    if (Length <= 0.0f) return 0.0f;
+
+    const float Wrapped = FMath::Fmod(Distance, Length);
+    return Wrapped < 0.0f ? Wrapped + Length : Wrapped;
+}
+
+void FTrafficLanePath::Sample(float Distance, FVector& OutLocation, FVector& OutDirection) const
+{
+    const float D = bClosedLoop ? WrapDistance(Distance) : FMath::Clamp(Distance, 0.0f, Length);
+    const float Key = D / Spacing;
+    const int32 Index = FMath::Clamp(FMath::FloorToInt32(Key), 0, Points.Num() - 2);
+    const FVector& A = Points[Index];
+    const FVector& B = Points[Index + 1];
+
+    OutLocation = FMath::Lerp(A, B, FMath::Clamp(Key - Index, 0.0f, 1.0f));
+    OutDirection = (B - A).GetSafeNormal();
+}
+
+float FTrafficLanePath::Project(const FVector& Location, float Guess, float Window, float* OutLateralOffset) const
+{
+    // The last point of a closed lane repeats the first
+    const int32 NumSamples = bClosedLoop ? Points.Num() - 1 : Points.Num();
+    const int32 Center = FMath::RoundToInt32(Guess / Spacing);
+    const int32 Reach = FMath::CeilToInt32(Window / Spacing);
+
+    int32 BestIndex = FMath::Clamp(Center, 0, NumSamples - 1);
+    float BestDistSq = TNumericLimits<float>::Max();
+    for (int32 Offset = -Reach; Offset <= Reach; ++Offset)
+    {
+        int32 Index = Center + Offset;
+        if (bClosedLoop)
+        {
+            Index = (Index % NumSamples + NumSamples) % NumSamples;
+        }
+        else if (Index < 0 || Index >= NumSamples)
+        {
+            continue;
+        }
+
+        const float DistSq = FVector::DistSquared(Points[Index], Location);
+        if (DistSq < BestDistSq)
+        {
+            BestDistSq = DistSq;
+            BestIndex = Index;
+        }
+    }
+
+    // The nearest point lies on one of the two segments either side of the nearest sample.
+    // Segment S runs from Points[S] to Points[S + 1]; on a closed lane the one before sample 0
+    // is the last.
+    const int32 LastSegment = Points.Num() - 2;
+    const int32 Before = BestIndex > 0 ? BestIndex - 1 : (bClosedLoop ? LastSegment : INDEX_NONE);
+    const int32 After = BestIndex <= LastSegment ? BestIndex : INDEX_NONE;
+
+    float Distance = BestIndex * Spacing;
+    FVector Nearest = Points[BestIndex];
+    FVector Direction = FVector::ForwardVector;
+    BestDistSq = TNumericLimits<float>::Max();
+    for (const int32 Segment : { Before, After })
+    {
+        if (Segment == INDEX_NONE) continue;
+
+        const FVector& A = Points[Segment];
+        const FVector AB = Points[Segment + 1] - A;
+        const float Alpha = FMath::Clamp(FVector::DotProduct(Location - A, AB) / FMath::Max(AB.SizeSquared(), UE_SMALL_NUMBER), 0.0f, 1.0f);
+        const FVector Point = A + AB * Alpha;
+        const float DistSq = FVector::DistSquared(Point, Location);
+        if (DistSq < BestDistSq)
+        {
+            BestDistSq = DistSq;
+            Distance = (Segment + Alpha) * Spacing;
+            Nearest = Point;
+            Direction = AB;
+        }
+    }
+
+    if (OutLateralOffset)
+    {
+        *OutLateralOffset = FVector::DotProduct(Location - Nearest, LaneRight(Direction));
+    }
+    return bClosedLoop ? WrapDistance(Distance) : FMath::Min(Distance, Length);
+}
+
+int32 FTrafficProxies::Add(int32 InLane, ETrafficVehicleKind InKind, int32 InInstance, float InDistance, float InDesiredSpeed)
+{
+    Leader.Add(INDEX_NONE);
+    Kind.Add(InKind);
+    State.Add(ETrafficProxyState::Kinematic);
+    Instance.Add(InInstance);
+    Distance.Add(InDistance);
+    PrevDistance.Add(InDistance);
+    Speed.Add(InDesiredSpeed);
+    DesiredSpeed.Add(InDesiredSpeed);
+    TargetSpeed.Add(InDesiredSpeed);
+    LateralOffset.Add(0.0f);
+    return Lane.Add(InLane);
+}
+
+void FTrafficProxies::Reset()
+{
+    Lane.Reset();
+    Leader.Reset();
+    Kind.Reset();
+    State.Reset();
+    Instance.Reset();
+    Distance.Reset();
+    PrevDistance.Reset();
+    Speed.Reset();
+    DesiredSpeed.Reset();
+    TargetSpeed.Reset();
+    LateralOffset.Reset();
+}
+
+void FTrafficProxies::Simulate(FTrafficProxies& Proxies, TConstArrayView<FTrafficLanePath> Lanes, const FTrafficDrivingParams& Params, float DeltaTime, bool bParallel)
+{
+    // Everyone follows where their leader was at the start of the step
+    Proxies.PrevDistance = Proxies.Distance;
+    const float LateralDecay = FMath::Exp(-DeltaTime / LateralReturnTime);
+
+    ParallelFor(TEXT("TrafficSimulate"), Proxies.Num(), TrafficBatchSize, [&Proxies, Lanes, &Params, DeltaTime, LateralDecay](int32 Index)
+    {
+        const FTrafficLanePath& Lane = Lanes[Proxies.Lane[Index]];
+        const int32 Leader = Proxies.Leader[Index];
+
+        // Keep the standstill gap plus TimeHeadway seconds of travel to the vehicle ahead
+        float Gap = TNumericLimits<float>::Max();
+        if (Leader != Index)
+        {
+            Gap = Lane.WrapDistance(Proxies.PrevDistance[Leader] - Proxies.PrevDistance[Index]) - Params.MinGap;
+        }
+        const float SafeSpeed = FMath::Max(Gap, 0.0f) / FMath::Max(Params.TimeHeadway, KINDA_SMALL_NUMBER);
+        const float Target = FMath::Min(Proxies.DesiredSpeed[Index], SafeSpeed);
+        Proxies.TargetSpeed[Index] = Target;
+
+        // Promoted vehicles get there through their own physics
+        if (Proxies.State[Index] == ETrafficProxyState::Promoted) return;
+
+        float Speed = Proxies.Speed[Index];
+        if (Gap <= 0.0f)
+        {
+            Speed = 0.0f;
+        }
+        else if (Target > Speed)
+        {
+            Speed = FMath::Min(Target, Speed + Params.MaxAcceleration * DeltaTime);
+        }
+        else
+        {
+            Speed = FMath::Max(Target, Speed - Params.MaxDeceleration * DeltaTime);
+        }
+
+        Proxies.Speed[Index] = Speed;
+        Proxies.Distance[Index] = Lane.WrapDistance(Proxies.Distance[Index] + Speed * DeltaTime);
+        Proxies.LateralOffset[Index] *= LateralDecay;
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void UTrafficSubsystem::RegisterTrafficManager(ATrafficManager* Manager)
+{
+    if (TrafficManager.IsValid() && TrafficManager.Get() != Manager)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Multiple traffic managers registered, using %s"), *GetNameSafe(Manager));
+        DemoteAll();
+    }
+
+    TrafficManager = Manager;
+    PrewarmVehicles();
+    bProxiesDirty = true;
+}
+
+void UTrafficSubsystem::UnregisterTrafficManager(ATrafficManager* Manager)
+{
+    if (TrafficManager.Get() != Manager) return;
+
+    DemoteAll();
+    Proxies.Reset();
+    ProxyVehicles.Reset();
+    TrafficManager.Reset();
+}
+
+void UTrafficSubsystem::RegisterLane(ATrafficLane* Lane)
+{
+    const USplineComponent* Spline = Lane ? Lane->Spline : nullptr;
+    if (!Spline || LaneActors.Contains(Lane)) return;
+
+    FTrafficLanePath Path;
+    Path.Length = Spline->GetSplineLength();
+    if (Path.Length <= 0.0f) return;
+
+    const int32 NumSegments = FMath::Max(FMath::CeilToInt32(Path.Length / LaneSampleSpacing), 1);
+    Path.Spacing = Path.Length / NumSegments;
+    Path.SpeedLimit = Lane->SpeedLimit;
+    Path.bClosedLoop = Spline->IsClosedLoop();
+    Path.Points.Reserve(NumSegments + 1);
+    for (int32 Segment = 0; Segment <= NumSegments; ++Segment)
+    {
+        Path.Points.Add(Spline->GetLocationAtDistanceAlongSpline(Segment * Path.Spacing, ESplineCoordinateSpace::World));
+    }
+
+    LaneActors.Add(Lane);
+    Lanes.Add(MoveTemp(Path));
+
+    // Lanes arrive one BeginPlay at a time; rebuild once on the next tick
+    bProxiesDirty = true;
+}
+
+void UTrafficSubsystem::UnregisterLane(ATrafficLane* Lane)
+{
+    const int32 Index = LaneActors.IndexOfByKey(Lane);
+    if (Index == INDEX_NONE) return;
+
+    LaneActors.RemoveAt(Index);
+    Lanes.RemoveAt(Index);
+    bProxiesDirty = true;
+}
+
+void UTrafficSubsystem::Tick(float DeltaTime)
+{
+    const ATrafficManager* Manager = TrafficManager.Get();
+    if (!Manager) return;
+
+    if (bProxiesDirty)
+    {
+        bProxiesDirty = false;
+        RebuildProxies();
+    }
+    if (Proxies.Num() == 0) return;
+
+    FTrafficDrivingParams Params;
+    Params.MinGap = Manager->MinGap;
+    Params.TimeHeadway = Manager->TimeHeadway;
+    Params.MaxAcceleration = Manager->MaxAcceleration;
+    Params.MaxDeceleration = Manager->MaxDeceleration;
+
+    {
+        SCOPE_CYCLE_COUNTER(STAT_TrafficSimulate);
+        SyncPromoted();
+        FTrafficProxies::Simulate(Proxies, Lanes, Params, DeltaTime, CVarTrafficParallel.GetValueOnGameThread());
+    }
+    {
+        SCOPE_CYCLE_COUNTER(STAT_TrafficDrivePromoted);
+        DrivePromoted();
+    }
+
+    TimeUntilHandoff -= DeltaTime;
+    if (TimeUntilHandoff <= 0.0f)
+    {
+        TimeUntilHandoff = CVarTrafficHandoffInterval.GetValueOnGameThread();
+        SCOPE_CYCLE_COUNTER(STAT_TrafficHandoff);
+        UpdateHandoff();
+    }
+
+    {
+        SCOPE_CYCLE_COUNTER(STAT_TrafficInstances);
+        UpdateInstances();
+    }
+
+    SET_DWORD_STAT(STAT_TrafficProxies, Proxies.Num());
+    SET_DWORD_STAT(STAT_TrafficPromoted, GetNumPromoted());
+}
+
+TStatId UTrafficSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UTrafficSubsystem, STATGROUP_Tickables);
+}
+
+void UTrafficSubsystem::RebuildProxies()
+{
+    // Hand every real vehicle back; positions are re-seeded below
+    DemoteAll();
+    Proxies.Reset();
+    ProxyVehicles.Reset();
+
+    ATrafficManager* Manager = TrafficManager.Get();
+    FRandomStream Stream(Manager->RandomSeed);
+    int32 NumCars = 0;
+    int32 NumBikes = 0;
+
+    for (int32 LaneIndex = 0; LaneIndex < Lanes.Num(); ++LaneIndex)
+    {
+        const FTrafficLanePath& Lane = Lanes[LaneIndex];
+        const int32 NumVehicles = FMath::Min(LaneActors[LaneIndex].IsValid() ? LaneActors[LaneIndex]->NumVehicles : 0,
+            FMath::FloorToInt32(Lane.Length / FMath::Max(Manager->MinGap, 1.0f)));
+        if (NumVehicles <= 0) continue;
+
+        // Evenly spread with some jitter, in driving order so each follows the next
+        const float SlotLength = Lane.Length / NumVehicles;
+        const int32 First = Proxies.Num();
+        for (int32 Slot = 0; Slot < NumVehicles; ++Slot)
+        {
+            const ETrafficVehicleKind Kind = Stream.FRand() < Manager->BikeFraction ? ETrafficVehicleKind::Bike : ETrafficVehicleKind::Car;
+            const int32 Instance = Kind == ETrafficVehicleKind::Bike ? NumBikes++ : NumCars++;
+            const float Distance = (Slot + Stream.FRandRange(0.0f, 0.3f)) * SlotLength;
+            Proxies.Add(LaneIndex, Kind, Instance, Distance, Lane.SpeedLimit * Stream.FRandRange(0.85f, 1.05f));
+        }
+        for (int32 Slot = 0; Slot < NumVehicles; ++Slot)
+        {
+            Proxies.Leader[First + Slot] = First + (Slot + 1) % NumVehicles;
+        }
+    }
+
+    ProxyVehicles.SetNum(Proxies.Num());
+    CarTransforms.SetNum(NumCars);
+    BikeTransforms.SetNum(NumBikes);
+
+    // Instance counts only change here; per-frame updates rewrite transforms in place
+    UpdateInstances();
+    Manager->CarInstances->ClearInstances();
+    Manager->CarInstances->AddInstances(CarTransforms, false, true);
+    Manager->BikeInstances->ClearInstances();
+    Manager->BikeInstances->AddInstances(BikeTransforms, false, true);
+}
+
+void UTrafficSubsystem::PrewarmVehicles()
+{
+    // Spawned now, while the level loads, rather than on the first promotion
+    UActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+    for (ETrafficVehicleKind Kind : { ETrafficVehicleKind::Car, ETrafficVehicleKind::Bike })
+    {
+        ActorPool->Prewarm(GetVehicleClass(Kind), GetPoolSize(Kind) - NumPromoted[static_cast<int32>(Kind)]);
+    }
+}
+
+void UTrafficSubsystem::DemoteAll()
+{
+    for (int32 Index = 0; Index < Proxies.Num(); ++Index)
+    {
+        if (Proxies.State[Index] == ETrafficProxyState::Promoted)
+        {
+            Demote(Index);
+        }
+    }
+}
+
+UClass* UTrafficSubsystem::GetVehicleClass(ETrafficVehicleKind Kind) const
+{
+    const ATrafficManager* Manager = TrafficManager.Get();
+    if (!Manager) return nullptr;
+
+    return Kind == ETrafficVehicleKind::Bike ? Manager->BikeClass.Get() : Manager->CarClass.Get();
+}
+
+int32 UTrafficSubsystem::GetPoolSize(ETrafficVehicleKind Kind) const
+{
+    const ATrafficManager* Manager = TrafficManager.Get();
+    if (!Manager) return 0;
+
+    return Kind == ETrafficVehicleKind::Bike ? Manager->BikePoolSize : Manager->CarPoolSize;
+}
+
+void UTrafficSubsystem::SyncPromoted()
+{
+    for (int32 Index = 0; Index < Proxies.Num(); ++Index)
+    {
+        if (Proxies.State[Index] != ETrafficProxyState::Promoted) continue;
+
+        AVehicleBase* Vehicle = ProxyVehicles[Index];
+        if (!IsValid(Vehicle))
+        {
+            // Destroyed by someone else; carry on as a proxy
+            ProxyVehicles[Index] = nullptr;
+            Proxies.State[Index] = ETrafficProxyState::Kinematic;
+            --NumPromoted[static_cast<int32>(Proxies.Kind[Index])];
+            continue;
+        }
+
+        if (Vehicle->GetController())
+        {
+            // The player took it; it is theirs now. Keep the pool at size with a replacement.
+            ProxyVehicles[Index] = nullptr;
+            Proxies.State[Index] = ETrafficProxyState::Vacated;
+            --NumPromoted[static_cast<int32>(Proxies.Kind[Index])];
+            PrewarmVehicles();
+            continue;
+        }
+
+        // Followers queue behind where the real vehicle actually is
+        const FTrafficLanePath& Lane = Lanes[Proxies.Lane[Index]];
+        const float Distance = Lane.Project(Vehicle->GetActorLocation(), Proxies.Distance[Index], LaneProjectWindow, &Proxies.LateralOffset[Index]);
+        FVector Location, Direction;
+        Lane.Sample(Distance, Location, Direction);
+        Proxies.Distance[Index] = Distance;
+        Proxies.Speed[Index] = FMath::Max(FVector::DotProduct(Vehicle->GetVelocity(), Direction), 0.0f);
+
+        if (!Lane.bClosedLoop && Distance >= Lane.Length - LaneEndMargin)
+        {
+            Demote(Index);
+        }
+    }
+}
+
+void UTrafficSubsystem::DrivePromoted()
+{
+    for (int32 Index = 0; Index < Proxies.Num(); ++Index)
+    {
+        if (Proxies.State[Index] != ETrafficProxyState::Promoted) continue;
+
+        AVehicleBase* Vehicle = ProxyVehicles[Index];
+        const FTrafficLanePath& Lane = Lanes[Proxies.Lane[Index]];
+        const float Speed = Proxies.Speed[Index];
+
+        // Steer for a point further down the lane, further ahead the faster we go
+        FVector Target, Direction;
+        Lane.Sample(Proxies.Distance[Index] + FMath::Max(MinLookAhead, Speed), Target, Direction);
+        const FVector Local = Vehicle->GetActorTransform().InverseTransformPositionNoScale(Target);
+
+        const float SpeedError = Proxies.TargetSpeed[Index] - Speed;
+        FVehicleInputFrame Input;
+        Input.Steer = FMath::Clamp(FMath::Atan2(Local.Y, Local.X) / FullSteerAngle, -1.0f, 1.0f);
+        Input.Throttle = FMath::Clamp(SpeedError / FullPedalSpeedError, 0.0f, 1.0f);
+        Input.Brake = FMath::Clamp(-SpeedError / FullPedalSpeedError, 0.0f, 1.0f);
+        Vehicle->SetInputFrame(Input);
+    }
+}
+
+void UTrafficSubsystem::UpdateHandoff()
+{
+    const APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    if (!Player) return;
+
+    const FVector PlayerLocation = Player->GetActorLocation();
+    const float PromoteRadiusSq = FMath::Square(TrafficManager->PromoteRadius);
+    const float DemoteRadiusSq = FMath::Square(FMath::Max(TrafficManager->DemoteRadius, TrafficManager->PromoteRadius));
+
+    TArray<TPair<float, int32>> Candidates;
+    for (int32 Index = 0; Index < Proxies.Num(); ++Index)
+    {
+        // Instance transforms hold every proxy's last location, promoted ones included
+        const TArray<FTransform>& Transforms = Proxies.Kind[Index] == ETrafficVehicleKind::Bike ? BikeTransforms : CarTransforms;
+        const float DistSq = FVector::DistSquared(Transforms[Proxies.Instance[Index]].GetLocation(), PlayerLocation);
+
+        switch (Proxies.State[Index])
+        {
+        case ETrafficProxyState::Kinematic:
+        {
+            // SyncPromoted would demote it again straight away; it comes back once it has wrapped
+            const FTrafficLanePath& Lane = Lanes[Proxies.Lane[Index]];
+            const bool bAtLaneEnd = !Lane.bClosedLoop && Proxies.Distance[Index] >= Lane.Length - LaneEndMargin;
+            if (DistSq < PromoteRadiusSq && !bAtLaneEnd)
+            {
+                Candidates.Emplace(DistSq, Index);
+            }
+            break;
+        }
+        case ETrafficProxyState::Promoted:
+            if (DistSq > DemoteRadiusSq)
+            {
+                Demote(Index);
+            }
+            break;
+        case ETrafficProxyState::Vacated:
+            if (DistSq > DemoteRadiusSq)
+            {
+                Proxies.State[Index] = ETrafficProxyState::Kinematic;
+            }
+            break;
+        }
+    }
+
+    // Nearest first, so a short pool goes to the vehicles the player is most likely to touch
+    Candidates.Sort([](const TPair<float, int32>& A, const TPair<float, int32>& B) { return A.Key < B.Key; });
+    int32 Misses = 0;
+    for (const TPair<float, int32>& Candidate : Candidates)
+    {
+        if (!Promote(Candidate.Value))
+        {
+            ++Misses;
+        }
+    }
+    SET_DWORD_STAT(STAT_TrafficPoolMisses, Misses);
+}
+
+bool UTrafficSubsystem::Promote(int32 Index)
+{
+    const ETrafficVehicleKind Kind = Proxies.Kind[Index];
+    if (NumPromoted[static_cast<int32>(Kind)] >= GetPoolSize(Kind)) return false;
+
+    // Same place, heading and speed as the proxy it replaces
+    FVector Location, Direction;
+    Lanes[Proxies.Lane[Index]].Sample(Proxies.Distance[Index], Location, Direction);
+    Location += LaneRight(Direction) * Proxies.LateralOffset[Index];
+    UActorPoolSubsystem* ActorPool = GetWorld()->GetSubsystem<UActorPoolSubsystem>();
+    AVehicleBase* Vehicle = Cast<AVehicleBase>(ActorPool->Acquire(GetVehicleClass(Kind), FTransform(Direction.Rotation(), Location)));
+    if (!Vehicle) return false;
+
+    USkeletalMeshComponent* Mesh = Vehicle->GetMesh();
+    Vehicle->WakeUp();
+    Mesh->SetAllPhysicsLinearVelocity(Direction * Proxies.Speed[Index]);
+    Mesh->SetAllPhysicsAngularVelocityInDegrees(FVector::ZeroVector);
+
+    ProxyVehicles[Index] = Vehicle;
+    Proxies.State[Index] = ETrafficProxyState::Promoted;
+    ++NumPromoted[static_cast<int32>(Kind)];
+    return true;
+}
+
+void UTrafficSubsystem::Demote(int32 Index)
+{
+    // Distance and speed were taken from the vehicle in SyncPromoted this frame
+    if (AVehicleBase* Vehicle = ProxyVehicles[Index])
+    {
+        GetWorld()->GetSubsystem<UActorPoolSubsystem>()->Release(Vehicle);
+    }
+
+    ProxyVehicles[Index] = nullptr;
+    Proxies.State[Index] = ETrafficProxyState::Kinematic;
+    --NumPromoted[static_cast<int32>(Proxies.Kind[Index])];
+}
+
+void UTrafficSubsystem::UpdateInstances()
+{
+    ParallelFor(TEXT("TrafficInstances"), Proxies.Num(), TrafficBatchSize, [this](int32 Index)
+    {
+        FVector Location, Direction;
+        Lanes[Proxies.Lane[Index]].Sample(Proxies.Distance[Index], Location, Direction);
+        Location += LaneRight(Direction) * Proxies.LateralOffset[Index];
+
+        // Promoted and vacated proxies collapse to nothing rather than changing the instance count
+        const bool bVisible = Proxies.State[Index] == ETrafficProxyState::Kinematic;
+        TArray<FTransform>& Transforms = Proxies.Kind[Index] == ETrafficVehicleKind::Bike ? BikeTransforms : CarTransforms;
+        Transforms[Proxies.Instance[Index]] = FTransform(Direction.ToOrientationQuat(), Location, bVisible ? FVector::OneVector : FVector::ZeroVector);
+    }, CVarTrafficParallel.GetValueOnGameThread() ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+
+    ATrafficManager* Manager = TrafficManager.Get();
+    if (CarTransforms.Num() > 0 && Manager->CarInstances->GetInstanceCount() == CarTransforms.Num())
+    {
+        Manager->CarInstances->BatchUpdateInstancesTransforms(0, CarTransforms, true, true, true);
+    }
+    if (BikeTransforms.Num() > 0 && Manager->BikeInstances->GetInstanceCount() == BikeTransforms.Num())
+    {
+        Manager->BikeInstances->BatchUpdateInstancesTransforms(0, BikeTransforms, true, true, true);
+    }
+}
+
+static FAutoConsoleCommand TrafficBenchmarkCommand(
+    TEXT("Traffic.Benchmark"),
+    TEXT("Times the traffic proxy simulation on synthetic ring lanes, single-threaded vs ParallelFor. Usage: Traffic.Benchmark [Proxies=5000] [Frames=600]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        const int32 NumProxies = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 5000;
+        const int32 NumFrames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 600;
+
+        // Concentric rings of 100 proxies each
+        static constexpr int32 ProxiesPerLane = 100;
+        const int32 NumLanes = FMath::DivideAndRoundUp(NumProxies, ProxiesPerLane);
+        TArray<FTrafficLanePath> Lanes;
+        FTrafficProxies Proxies;
+        FRandomStream Stream(NumProxies);
+        for (int32 LaneIndex = 0; LaneIndex < NumLanes; ++LaneIndex)
+        {
+            FTrafficLanePath& Lane = Lanes.AddDefaulted_GetRef();
+            const float Radius = 20000.0f + LaneIndex * 500.0f;
+            const int32 NumSegments = FMath::CeilToInt32(UE_TWO_PI * Radius / LaneSampleSpacing);
+            for (int32 Segment = 0; Segment <= NumSegments; ++Segment)
+            {
+                const float Angle = UE_TWO_PI * Segment / NumSegments;
+                Lane.Points.Add(FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.0f));
+            }
+            Lane.Length = UE_TWO_PI * Radius;
+            Lane.Spacing = Lane.Length / NumSegments;
+            Lane.SpeedLimit = 1400.0f;
+            Lane.bClosedLoop = true;
+
+            const int32 First = Proxies.Num();
+            const int32 Count = FMath::Min(ProxiesPerLane, NumProxies - First);
+            for (int32 Slot = 0; Slot < Count; ++Slot)
+            {
+                Proxies.Add(LaneIndex, ETrafficVehicleKind::Car, First + Slot, Slot * Lane.Length / Count, Lane.SpeedLimit * Stream.FRandRange(0.85f, 1.05f));
+            }
+            for (int32 Slot = 0; Slot < Count; ++Slot)
+            {
+                Proxies.Leader[First + Slot] = First + (Slot + 1) % Count;
+            }
+        }
+
+        const FTrafficProxies Initial = Proxies;
+        auto RunFrames = [&Proxies, &Initial, &Lanes, NumFrames](bool bParallel)
+        {
+            Proxies = Initial;
+            const FTrafficDrivingParams Params;
+            uint64 Cycles = 0;
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                const uint64 Start = FPlatformTime::Cycles64();
+                FTrafficProxies::Simulate(Proxies, Lanes, Params, 1.0f / 60.0f, bParallel);
+                Cycles += FPlatformTime::Cycles64() - Start;
+            }
+            return FPlatformTime::ToMilliseconds64(Cycles) / NumFrames;
+        };
+
+        const double SerialMs = RunFrames(false);
+        const double ParallelMs = RunFrames(true);
+        UE_LOG(LogTemp, Log, TEXT("Traffic simulate, %d proxies on %d lanes: %.4f ms/frame single-threaded, %.4f ms/frame parallel"), Proxies.Num(), NumLanes, SerialMs, ParallelMs);
+    }));
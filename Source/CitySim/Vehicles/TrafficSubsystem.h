@@ -0,0 +1,127 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TrafficSubsystem.generated.h"
+
+class AVehicleBase;
+class ATrafficLane;
+class ATrafficManager;
+
+enum class ETrafficVehicleKind : uint8
+{
+    Car,
+    Bike
+};
+
+enum class ETrafficProxyState : uint8
+{
+    Kinematic, // Moved along its lane and drawn as an instance
+    Promoted,  // Stood in for by a pooled vehicle that the subsystem drives
+    Vacated    // Its vehicle was taken by the player; hidden until the player moves away
+};
+
+// A lane spline sampled at even spacing, so proxies move without touching the spline component
+struct FTrafficLanePath
+{
+    TArray<FVector> Points;
+    float Spacing = 100.0f;
+    float Length = 0.0f;
+    float SpeedLimit = 0.0f;
+    bool bClosedLoop = false;
+
+    void Sample(float Distance, FVector& OutLocation, FVector& OutDirection) const;
+    float WrapDistance(float Distance) const;
+
+    // Distance along the lane of the point nearest Location, searched within Window of Guess.
+    // OutLateralOffset is how far Location lies right of the lane there.
+    float Project(const FVector& Location, float Guess, float Window, float* OutLateralOffset = nullptr) const;
+};
+
+struct FTrafficDrivingParams
+{
+    float MinGap = 700.0f;
+    float TimeHeadway = 1.5f;
+    float MaxAcceleration = 300.0f;
+    float MaxDeceleration = 900.0f;
+};
+
+// Every traffic vehicle, one contiguous array per field. Proxies on a lane form a ring in
+// driving order, each following its Leader.
+struct FTrafficProxies
+{
+    TArray<int32> Lane;
+    TArray<int32> Leader;
+    TArray<ETrafficVehicleKind> Kind;
+    TArray<ETrafficProxyState> State;
+    TArray<int32> Instance; // Index into the instanced mesh for Kind
+    TArray<float> Distance;
+    TArray<float> PrevDistance;
+    TArray<float> Speed;
+    TArray<float> DesiredSpeed;
+    TArray<float> TargetSpeed;
+    TArray<float> LateralOffset; // Right of the lane center, left by a demoted vehicle and eased out
+
+    int32 Num() const { return Lane.Num(); }
+    int32 Add(int32 InLane, ETrafficVehicleKind InKind, int32 InInstance, float InDistance, float InDesiredSpeed);
+    void Reset();
+
+    // Car following for every proxy and integration along the lane for the kinematic ones.
+    // Touches no UObjects, so it is safe to spread across worker threads.
+    static void Simulate(FTrafficProxies& Proxies, TConstArrayView<FTrafficLanePath> Lanes, const FTrafficDrivingParams& Params, float DeltaTime, bool bParallel);
+};
+
+// Ambient traffic. Distant vehicles are kinematic proxies on lane splines, drawn by the traffic
+// manager's instanced meshes with no physics. Proxies near the player are handed to
+// ACarVehicle / ABikeVehicle actors from UActorPoolSubsystem at the same position and velocity,
+// driven along the lane through SetInputFrame, and released back once they leave the demote
+// radius.
+UCLASS()
+class BELIVE_API UTrafficSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    void RegisterTrafficManager(ATrafficManager* Manager);
+    void UnregisterTrafficManager(ATrafficManager* Manager);
+    void RegisterLane(ATrafficLane* Lane);
+    void UnregisterLane(ATrafficLane* Lane);
+
+    int32 GetNumProxies() const { return Proxies.Num(); }
+    int32 GetNumPromoted() const { return NumPromoted[0] + NumPromoted[1]; }
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    TWeakObjectPtr<ATrafficManager> TrafficManager;
+
+    // Parallel arrays; lanes are baked when registered
+    TArray<TWeakObjectPtr<ATrafficLane>> LaneActors;
+    TArray<FTrafficLanePath> Lanes;
+
+    FTrafficProxies Proxies;
+
+    // Parallel to Proxies; set while a proxy is promoted
+    UPROPERTY()
+    TArray<TObjectPtr<AVehicleBase>> ProxyVehicles;
+
+    TArray<FTransform> CarTransforms;
+    TArray<FTransform> BikeTransforms;
+
+    bool bProxiesDirty = false;
+    float TimeUntilHandoff = 0.0f;
+    int32 NumPromoted[2] = {}; // Per ETrafficVehicleKind; capped at the manager's pool sizes
+
+    void RebuildProxies();
+    void PrewarmVehicles();
+    void DemoteAll();
+    UClass* GetVehicleClass(ETrafficVehicleKind Kind) const;
+    int32 GetPoolSize(ETrafficVehicleKind Kind) const;
+
+    void SyncPromoted();
+    void DrivePromoted();
+    void UpdateHandoff();
+    bool Promote(int32 Index);
+    void Demote(int32 Index);
+    void UpdateInstances();
+};
@@ -1,9 +1,10 @@
 #include "Vehicles/VehicleBase.h"
+#include "Vehicles/VehicleEffectsSubsystem.h"
+#include "Vehicles/FixedStepVehicleMovementComponent.h"
+#include "Vehicles/VehicleFrictionSubsystem.h"
 #include "ChaosVehicleMovementComponent.h"
-#include "Components/TimelineComponent.h"
 #include "NiagaraComponent.h"
 #include "Components/AudioComponent.h"
-#include "Curves/CurveFloat.h"
 #include "NiagaraFunctionLibrary.h"
 #include "NiagaraSystem.h"
 #include "Engine/World.h"
@@ -11,30 +12,58 @@
 #include "GameFramework/SpringArmComponent.h"
 #include "Camera/CameraComponent.h"
 #include "Kismet/GameplayStatics.h"
+#include "Sound/SoundBase.h"
+#include "HAL/IConsoleManager.h"
+#include "PhysicsEngine/PhysicsSettings.h"
 
-AVehicleBase::AVehicleBase()
+DECLARE_CYCLE_STAT(TEXT("Vehicle Create Driver Components"), STAT_VehicleCreateDriverComponents, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicle Driver Component Sets"), STAT_VehicleDriverComponentSets, STATGROUP_Vehicles);
+
+static TAutoConsoleVariable<bool> CVarVehicleTelemetryEnable(
+    TEXT("Vehicle.Telemetry.Enable"), true,
+    TEXT("Record throttle, steering, brake, RPM, speed, tire smoke and frame time of driven vehicles into a ring buffer."));
+
+static TAutoConsoleVariable<int32> CVarVehicleTelemetryCapacity(
+    TEXT("Vehicle.Telemetry.Capacity"), 3600,
+    TEXT("Frames of telemetry kept per driven vehicle. Read when a vehicle is first driven."));
+
+// Hitches beyond this many input steps are dropped rather than replayed
+static constexpr int32 MaxInputStepsPerFrame = 8;
+
+void FVehicleInputSmoothing::Step(FVehicleInputFrame& Current, const FVehicleInputFrame& Target, float DeltaTime) const
+{
+    Current.Throttle = FMath::FInterpTo(Current.Throttle, Target.Throttle, DeltaTime, ThrottleSpeed);
+    Current.Steer = FMath::FInterpTo(Current.Steer, Target.Steer, DeltaTime, SteerSpeed);
+    Current.Brake = FMath::FInterpTo(Current.Brake, Target.Brake, DeltaTime, BrakeSpeed);
+    Current.bHandbrake = Target.bHandbrake;
+}
+
+int32 FVehicleInputStepper::Advance(float DeltaTime)
+{
+    Accumulator += DeltaTime;
+    // The small bias keeps frame and step boundaries that coincide exactly from rounding down
+    const int32 Steps = FMath::FloorToInt32((Accumulator + KINDA_SMALL_NUMBER) / StepSize);
+    Accumulator -= Steps * StepSize;
+    if (Steps > MaxInputStepsPerFrame)
+    {
+        Accumulator = 0.0f;
+        return MaxInputStepsPerFrame;
+    }
+    return Steps;
+}
+
+AVehicleBase::AVehicleBase(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer.SetDefaultSubobjectClass<UFixedStepVehicleMovementComponent>(VehicleMovementComponentName))
 {
     PrimaryActorTick.bCanEverTick = true;
+    PrimaryActorTick.bStartWithTickEnabled = false; // Only driven vehicles tick; cosmetics run in UVehicleEffectsSubsystem
     Tags.Add(FName("Usable"));
 
-    // Enhanced Spring Arm for Vehicle Camera
-    USpringArmComponent* VehicleSpringArm = CreateDefaultSubobject<USpringArmComponent>(TEXT("VehicleSpringArm"));
-    VehicleSpringArm->SetupAttachment(RootComponent);
-    VehicleSpringArm->TargetArmLength = CameraDistance;
-    VehicleSpringArm->SetRelativeLocation(FVector(0.0f, 0.0f, CameraHeight));
-    VehicleSpringArm->bUsePawnControlRotation = true;
-    VehicleSpringArm->bEnableCameraLag = true;
-    VehicleSpringArm->CameraLagSpeed = CameraLagSpeed;
-    VehicleSpringArm->CameraRotationLagSpeed = 3.0f;
-    VehicleSpringArm->CameraLagMaxDistance = 100.0f;
-    VehicleSpringArm->bDoCollisionTest = true;
-    VehicleSpringArm->ProbeSize = 15.0f;
+    // Collisions wake sleeping vehicles
+    GetMesh()->SetNotifyRigidBodyCollision(true);
 
-    // Vehicle Camera
-    UCameraComponent* VehicleCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("VehicleCamera"));
-    VehicleCamera->SetupAttachment(VehicleSpringArm);
-    VehicleCamera->bUsePawnControlRotation = false;
-    VehicleCamera->FieldOfView = 85.0f;
+    // The camera rig, horn, brake and tire screech audio and turn signal VFX are only
+    // needed while someone drives; they are created in OnEnteredVehicle
 
     // Visual Effects
     ExhaustVFX = CreateDefaultSubobject<UNiagaraComponent>(TEXT("ExhaustVFX"));
@@ -49,81 +78,114 @@ AVehicleBase::AVehicleBase()
     BrakeLightVFX->SetupAttachment(RootComponent);
     BrakeLightVFX->SetAutoActivate(false);
 
-    TurnSignalVFX = CreateDefaultSubobject<UNiagaraComponent>(TEXT("TurnSignalVFX"));
-    TurnSignalVFX->SetupAttachment(RootComponent);
-    TurnSignalVFX->SetAutoActivate(false);
-
     // Audio Components
     EngineAudio = CreateDefaultSubobject<UAudioComponent>(TEXT("EngineAudio"));
     EngineAudio->SetupAttachment(RootComponent);
-    EngineAudio->bAutoActivate = true;
-
-    HornAudio = CreateDefaultSubobject<UAudioComponent>(TEXT("HornAudio"));
-    HornAudio->SetupAttachment(RootComponent);
-    HornAudio->bAutoActivate = false;
-
-    BrakeAudio = CreateDefaultSubobject<UAudioComponent>(TEXT("BrakeAudio"));
-    BrakeAudio->SetupAttachment(RootComponent);
-    BrakeAudio->bAutoActivate = false;
-
-    TireScreechAudio = CreateDefaultSubobject<UAudioComponent>(TEXT("TireScreechAudio"));
-    TireScreechAudio->SetupAttachment(RootComponent);
-    TireScreechAudio->bAutoActivate = false;
+    EngineAudio->bAutoActivate = false; // Started by UVehicleEffectsSubsystem if it wins an engine voice
 
-    // Timelines
-    EngineSoundTimeline = CreateDefaultSubobject<UTimelineComponent>(TEXT("EngineSoundTimeline"));
-    ExhaustVFXTimeline = CreateDefaultSubobject<UTimelineComponent>(TEXT("ExhaustVFXTimeline"));
-    TurnSignalTimeline = CreateDefaultSubobject<UTimelineComponent>(TEXT("TurnSignalTimeline"));
+    // Engine and exhaust curve modulation and turn signal blinking are driven by
+    // UVehicleEffectsSubsystem from world time rather than per-vehicle timelines
 }
 
 void AVehicleBase::BeginPlay()
 {
     Super::BeginPlay();
 
-    // Setup Timelines
-    if (EngineSoundCurve)
+    // Inputs are applied once per frame from Tick, ahead of the movement component consuming them
+    CachedMovement = Cast<UChaosVehicleMovementComponent>(GetVehicleMovement());
+
+    // The game thread's copy of the smoothed input mirrors the physics thread's per-step smoothing
+    const UPhysicsSettings* PhysicsSettings = UPhysicsSettings::Get();
+    InputStepper.StepSize = PhysicsSettings->AsyncFixedTimeStepSize;
+    if (bFixedStepInput && !PhysicsSettings->bTickPhysicsAsync)
     {
-        FOnTimelineFloat EngineSoundCallback;
-        EngineSoundCallback.BindUFunction(this, FName("OnEngineSoundUpdate"));
-        EngineSoundTimeline->AddInterpFloat(EngineSoundCurve, EngineSoundCallback);
-        EngineSoundTimeline->SetLooping(true);
-        EngineSoundTimeline->Play();
+        static bool bWarned = false;
+        UE_CLOG(!bWarned, LogTemp, Warning, TEXT("%s has bFixedStepInput set, but it has no effect unless bTickPhysicsAsync is enabled"), *GetName());
+        bWarned = true;
     }
-
-    if (ExhaustVFXCurve)
+    if (CachedMovement)
     {
-        FOnTimelineFloat ExhaustVFXCallback;
-        ExhaustVFXCallback.BindUFunction(this, FName("OnExhaustVFXUpdate"));
-        ExhaustVFXTimeline->AddInterpFloat(ExhaustVFXCurve, ExhaustVFXCallback);
-        ExhaustVFXTimeline->SetLooping(true);
-        ExhaustVFXTimeline->Play();
+        CachedMovement->PrimaryComponentTick.AddPrerequisite(this, PrimaryActorTick);
     }
 
-    // Setup Turn Signal Timeline
-    FOnTimelineFloat TurnSignalCallback;
-    TurnSignalCallback.BindUFunction(this, FName("OnTurnSignalUpdate"));
-    TurnSignalTimeline->AddInterpFloat(nullptr, TurnSignalCallback);
-    TurnSignalTimeline->SetLooping(true);
-
     // Initialize engine sound
-    CurrentEngineRPM = EngineIdleRPM;
     if (EngineAudio)
     {
-        EngineAudio->SetFloatParameter(FName("RPM"), CurrentEngineRPM);
+        EngineAudio->SetFloatParameter(FName("RPM"), EngineIdleRPM);
+    }
+
+    if (UVehicleEffectsSubsystem* EffectsSubsystem = GetWorld()->GetSubsystem<UVehicleEffectsSubsystem>())
+    {
+        EffectsSubsystem->RegisterVehicle(this);
+    }
+
+    if (UVehicleSignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UVehicleSignificanceSubsystem>())
+    {
+        SignificanceSubsystem->RegisterVehicle(this);
+    }
+
+    if (UVehicleFrictionSubsystem* FrictionSubsystem = GetWorld()->GetSubsystem<UVehicleFrictionSubsystem>())
+    {
+        FrictionSubsystem->RegisterVehicle(this);
+    }
+
+    // Parked vehicles start asleep until someone comes near or drives them
+    if (bStartAsleep && !GetController())
+    {
+        Sleep();
+    }
+    else
+    {
+        RefreshCosmetics();
+    }
+}
+
+void AVehicleBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UVehicleFrictionSubsystem* FrictionSubsystem = GetWorld()->GetSubsystem<UVehicleFrictionSubsystem>())
+    {
+        FrictionSubsystem->UnregisterVehicle(this);
+    }
+
+    if (UVehicleSignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UVehicleSignificanceSubsystem>())
+    {
+        SignificanceSubsystem->UnregisterVehicle(this);
+    }
+
+    if (UVehicleEffectsSubsystem* EffectsSubsystem = GetWorld()->GetSubsystem<UVehicleEffectsSubsystem>())
+    {
+        EffectsSubsystem->UnregisterVehicle(this);
     }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void AVehicleBase::PossessedBy(AController* NewController)
+{
+    Super::PossessedBy(NewController);
+    WakeUp();
+
+    // Player and AI drivers alike feed input that Tick has to process
+    SetActorTickEnabled(true);
+}
+
+void AVehicleBase::UnPossessed()
+{
+    Super::UnPossessed();
+
+    // Let go of the controls instead of leaving the last axis values latched
+    ReleaseControls();
+    SetActorTickEnabled(false);
 }
 
 void AVehicleBase::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
-    UpdateEngineSound(DeltaTime);
-    UpdateExhaustVFX(DeltaTime);
-    UpdateTireSmoke(DeltaTime);
-    UpdateBrakeLights();
-    UpdateTurnSignals(DeltaTime);
+    ProcessInput(DeltaTime);
     UpdateVehiclePhysics(DeltaTime);
     UpdateCameraEffects(DeltaTime);
+    RecordTelemetry(DeltaTime);
 }
 
 void AVehicleBase::SetupPlayerInputComponent(UInputComponent* IC)
@@ -144,38 +206,115 @@ void AVehicleBase::SetupPlayerInputComponent(UInputComponent* IC)
     IC->BindAction("RightTurnSignal", IE_Pressed, this, &AVehicleBase::RightTurnSignal);
 }
 
-void AVehicleBase::Throttle(float V)
+void AVehicleBase::SetInputFrame(const FVehicleInputFrame& Input)
 {
-    float TargetThrottle = FMath::Clamp(V, -MaxThrottle, MaxThrottle);
-    CurrentThrottle = FMath::FInterpTo(CurrentThrottle, TargetThrottle, GetWorld()->GetDeltaSeconds(), AccelerationSmoothness);
-    
-    if (auto* Move = Cast<UChaosVehicleMovementComponent>(GetVehicleMovement()))
+    RawInput = Input;
+
+    // Idle frames neither wake the vehicle nor keep it awake, so it can still go back to sleep
+    if (Input.IsIdle()) return;
+    WakeUp();
+
+    // Externally driven vehicles need the tick to consume their input; Sleep turns it off again
+    SetActorTickEnabled(true);
+}
+
+void AVehicleBase::ReleaseControls()
+{
+    RawInput = FVehicleInputFrame();
+    CurrentThrottle = 0.0f;
+    CurrentSteering = 0.0f;
+    CurrentBrake = 0.0f;
+    InputStepper.Accumulator = 0.0f;
+    if (UFixedStepVehicleMovementComponent* FixedStepMovement = Cast<UFixedStepVehicleMovementComponent>(CachedMovement))
     {
-        Move->SetThrottleInput(CurrentThrottle);
+        FixedStepMovement->ResetInput();
     }
+    ProcessInput(0.0f);
+}
+
+FVehicleInputSmoothing AVehicleBase::GetInputSmoothing() const
+{
+    FVehicleInputSmoothing Smoothing;
+    Smoothing.ThrottleSpeed = AccelerationSmoothness;
+    Smoothing.SteerSpeed = SteeringSmoothness;
+    Smoothing.BrakeSpeed = BrakeSmoothness;
+    return Smoothing;
+}
+
+FVehicleInputFrame AVehicleBase::GetSmoothedInput() const
+{
+    FVehicleInputFrame Smoothed;
+    Smoothed.Throttle = CurrentThrottle;
+    Smoothed.Steer = CurrentSteering;
+    Smoothed.Brake = CurrentBrake;
+    Smoothed.bHandbrake = bHandbrakePressed;
+    return Smoothed;
+}
+
+// Axis and action bindings only record raw input; ProcessInput does the rest once per frame
+void AVehicleBase::Throttle(float V)
+{
+    RawInput.Throttle = V;
 }
 
 void AVehicleBase::Steer(float V)
 {
-    float TargetSteering = FMath::Clamp(V, -MaxSteer, MaxSteer);
-    CurrentSteering = FMath::FInterpTo(CurrentSteering, TargetSteering, GetWorld()->GetDeltaSeconds(), SteeringSmoothness);
-    
-    if (auto* Move = Cast<UChaosVehicleMovementComponent>(GetVehicleMovement()))
-    {
-        Move->SetSteeringInput(CurrentSteering);
-    }
+    RawInput.Steer = V;
 }
 
 void AVehicleBase::Brake(float V)
 {
-    float TargetBrake = FMath::Clamp(V, 0.f, 1.f);
-    CurrentBrake = FMath::FInterpTo(CurrentBrake, TargetBrake, GetWorld()->GetDeltaSeconds(), BrakeSmoothness);
-    
-    if (auto* Move = Cast<UChaosVehicleMovementComponent>(GetVehicleMovement()))
+    RawInput.Brake = V;
+}
+
+void AVehicleBase::HandbrakePressed()
+{
+    RawInput.bHandbrake = true;
+}
+
+void AVehicleBase::HandbrakeReleased()
+{
+    RawInput.bHandbrake = false;
+}
+
+void AVehicleBase::ProcessInput(float DeltaTime)
+{
+    FVehicleInputFrame Target;
+    Target.Throttle = FMath::Clamp(RawInput.Throttle, -MaxThrottle, MaxThrottle);
+    Target.Steer = FMath::Clamp(RawInput.Steer, -MaxSteer, MaxSteer);
+    Target.Brake = FMath::Clamp(RawInput.Brake, 0.f, 1.f);
+    Target.bHandbrake = RawInput.bHandbrake;
+
+    const FVehicleInputSmoothing Smoothing = GetInputSmoothing();
+    const UFixedStepVehicleMovementComponent* FixedStepMovement = Cast<UFixedStepVehicleMovementComponent>(CachedMovement);
+    const bool bSmoothPerPhysicsStep = FixedStepMovement && FixedStepMovement->IsSmoothingPerPhysicsStep();
+
+    FVehicleInputFrame Smoothed = GetSmoothedInput();
+    if (bSmoothPerPhysicsStep)
+    {
+        // The physics thread does the real smoothing; this copy only drives effects and telemetry
+        for (int32 Steps = InputStepper.Advance(DeltaTime); Steps > 0; --Steps)
+        {
+            Smoothing.Step(Smoothed, Target, InputStepper.StepSize);
+        }
+        Smoothed.bHandbrake = Target.bHandbrake;
+    }
+    else
+    {
+        Smoothing.Step(Smoothed, Target, DeltaTime);
+    }
+
+    CurrentThrottle = Smoothed.Throttle;
+    CurrentSteering = Smoothed.Steer;
+    CurrentBrake = Smoothed.Brake;
+    bHandbrakePressed = Smoothed.bHandbrake;
+    if (!RawInput.IsIdle())
     {
-        Move->SetBrakeInput(CurrentBrake);
+        LastDriveTime = GetWorld()->GetTimeSeconds();
     }
 
+    ApplyMovementInput(bSmoothPerPhysicsStep ? Target : Smoothed);
+
     // Brake effects
     if (CurrentBrake > 0.1f && !bBrakePressed)
     {
@@ -195,22 +334,14 @@ void AVehicleBase::Brake(float V)
     }
 }
 
-void AVehicleBase::HandbrakePressed()
+void AVehicleBase::ApplyMovementInput(const FVehicleInputFrame& Input)
 {
-    bHandbrakePressed = true;
-    if (auto* Move = Cast<UChaosVehicleMovementComponent>(GetVehicleMovement()))
-    {
-        Move->SetHandbrakeInput(true);
-    }
-}
+    if (!CachedMovement) return;
 
-void AVehicleBase::HandbrakeReleased()
-{
-    bHandbrakePressed = false;
-    if (auto* Move = Cast<UChaosVehicleMovementComponent>(GetVehicleMovement()))
-    {
-        Move->SetHandbrakeInput(false);
-    }
+    CachedMovement->SetThrottleInput(Input.Throttle);
+    CachedMovement->SetSteeringInput(Input.Steer);
+    CachedMovement->SetBrakeInput(Input.Brake);
+    CachedMovement->SetHandbrakeInput(Input.bHandbrake);
 }
 
 void AVehicleBase::HornPressed()
@@ -235,7 +366,8 @@ void AVehicleBase::HornReleased()
 void AVehicleBase::ToggleLights()
 {
     bLightsOn = !bLightsOn;
-    // You can add light component activation/deactivation here
+
+    // UVehicleEffectsSubsystem sets the emissive and, budget permitting, gives us a spot light
 }
 
 void AVehicleBase::LeftTurnSignal()
@@ -245,11 +377,10 @@ void AVehicleBase::LeftTurnSignal()
     
     if (bLeftTurnSignal)
     {
-        TurnSignalTimeline->Play();
+        TurnSignalOnTime = GetWorld()->GetTimeSeconds();
     }
     else
     {
-        TurnSignalTimeline->Stop();
         if (TurnSignalVFX)
         {
             TurnSignalVFX->Deactivate();
@@ -264,11 +395,10 @@ void AVehicleBase::RightTurnSignal()
     
     if (bRightTurnSignal)
     {
-        TurnSignalTimeline->Play();
+        TurnSignalOnTime = GetWorld()->GetTimeSeconds();
     }
     else
     {
-        TurnSignalTimeline->Stop();
         if (TurnSignalVFX)
         {
             TurnSignalVFX->Deactivate();
@@ -276,178 +406,307 @@ void AVehicleBase::RightTurnSignal()
     }
 }
 
-void AVehicleBase::UpdateEngineSound(float DeltaTime)
+void AVehicleBase::UpdateVehiclePhysics(float DeltaTime)
 {
-    if (!EngineAudio) return;
+    // Enhanced physics updates can go here
+    // Such as suspension effects, weight transfer, etc.
+}
 
-    // Calculate engine RPM based on throttle and speed
+void AVehicleBase::UpdateCameraEffects(float DeltaTime)
+{
+    // Camera shake based on speed and terrain
     float Speed = GetVelocity().Size();
-    float TargetRPM = EngineIdleRPM + (MaxEngineRPM - EngineIdleRPM) * FMath::Abs(CurrentThrottle);
-    
-    // Add speed influence
-    TargetRPM += Speed * 10.0f;
-    TargetRPM = FMath::Clamp(TargetRPM, EngineIdleRPM, MaxEngineRPM);
-    
-    CurrentEngineRPM = FMath::FInterpTo(CurrentEngineRPM, TargetRPM, DeltaTime, 2.0f);
+    float CameraShake = FMath::Clamp(Speed / 1000.0f, 0.0f, 0.1f);
     
-    // Update engine sound parameters
-    EngineAudio->SetFloatParameter(FName("RPM"), CurrentEngineRPM);
-    EngineAudio->SetFloatParameter(FName("Throttle"), FMath::Abs(CurrentThrottle));
-    EngineAudio->SetFloatParameter(FName("Speed"), Speed);
+    // You can apply camera shake here
 }
 
-void AVehicleBase::UpdateExhaustVFX(float DeltaTime)
+void AVehicleBase::RecordTelemetry(float DeltaTime)
 {
-    if (!ExhaustVFX) return;
+    if (!CVarVehicleTelemetryEnable.GetValueOnGameThread()) return;
 
-    float ExhaustIntensity = FMath::Abs(CurrentThrottle) * ExhaustVFXIntensity;
-    
-    if (ExhaustIntensity > 0.1f)
+    if (!Telemetry.IsInitialized())
     {
-        if (!ExhaustVFX->IsActive())
-        {
-            ExhaustVFX->Activate();
-        }
-        ExhaustVFX->SetFloatParameter(FName("Intensity"), ExhaustIntensity);
-    }
-    else
-    {
-        if (ExhaustVFX->IsActive())
-        {
-            ExhaustVFX->Deactivate();
-        }
+        Telemetry.Init(CVarVehicleTelemetryCapacity.GetValueOnGameThread());
     }
+
+    // RPM and tire smoke are as of the last effects update, which runs after actor ticks
+    const UVehicleEffectsSubsystem* EffectsSubsystem = GetWorld()->GetSubsystem<UVehicleEffectsSubsystem>();
+    const EVehicleEffectFlags EffectFlags = EffectsSubsystem ? EffectsSubsystem->GetEffectFlags(this) : EVehicleEffectFlags::None;
+
+    FVehicleTelemetrySample Sample;
+    Sample.Frame = static_cast<uint32>(GFrameCounter);
+    Sample.Time = GetWorld()->GetTimeSeconds();
+    Sample.FrameTime = DeltaTime;
+    Sample.Throttle = CurrentThrottle;
+    Sample.Steer = CurrentSteering;
+    Sample.Brake = CurrentBrake;
+    Sample.EngineRPM = EffectsSubsystem ? EffectsSubsystem->GetEngineRPM(this) : EngineIdleRPM;
+    Sample.Speed = GetVelocity().Size();
+    if (EnumHasAnyFlags(EffectFlags, EVehicleEffectFlags::TireSmoke)) Sample.Flags |= EVehicleTelemetryFlags::TireSmoke;
+    if (bHandbrakePressed) Sample.Flags |= EVehicleTelemetryFlags::Handbrake;
+    Telemetry.Record(Sample);
 }
 
-void AVehicleBase::UpdateTireSmoke(float DeltaTime)
+bool AVehicleBase::FlushTelemetry(const FString& Path, bool bReset)
 {
-    if (!TireSmokeVFX) return;
+    if (Telemetry.Num() == 0) return false;
 
-    float Speed = GetVelocity().Size();
-    float Acceleration = (Speed - LastSpeed) / DeltaTime;
-    
-    // Check for hard braking or acceleration
-    bool bShouldSmoke = (FMath::Abs(CurrentBrake) > TireSmokeThreshold) || 
-                       (FMath::Abs(Acceleration) > 500.0f) ||
-                       (bHandbrakePressed && Speed > 100.0f);
+    const bool bSaved = Telemetry.Save(Path, GetName());
+    if (bSaved && bReset)
+    {
+        Telemetry.Reset();
+    }
+    return bSaved;
+}
 
-    if (bShouldSmoke)
+void AVehicleBase::PlayTireScreechSound()
+{
+    if (TireScreechAudio && !TireScreechAudio->IsPlaying())
     {
-        if (!TireSmokeVFX->IsActive())
-        {
-            TireSmokeVFX->Activate();
-            PlayTireScreechSound();
-        }
+        TireScreechAudio->Play();
     }
-    else
+}
+
+void AVehicleBase::StopTireScreechSound()
+{
+    if (TireScreechAudio && TireScreechAudio->IsPlaying())
     {
-        if (TireSmokeVFX->IsActive())
-        {
-            TireSmokeVFX->Deactivate();
-            StopTireScreechSound();
-        }
+        TireScreechAudio->Stop();
     }
+}
 
-    LastSpeed = Speed;
+void AVehicleBase::SetSignificance(EVehicleSignificance NewSignificance)
+{
+    if (NewSignificance == Significance) return;
+
+    Significance = NewSignificance;
+    RefreshCosmetics();
 }
 
-void AVehicleBase::UpdateBrakeLights()
+void AVehicleBase::RefreshCosmetics()
 {
-    if (!BrakeLightVFX) return;
+    // Sleeping vehicles get no cosmetics whatever their significance
+    const EVehicleSignificance Effective = bSleeping ? EVehicleSignificance::Low : Significance;
 
-    if (CurrentBrake > 0.1f || bHandbrakePressed)
+    // The effects subsystem handles the update rate
+    if (UVehicleEffectsSubsystem* EffectsSubsystem = GetWorld()->GetSubsystem<UVehicleEffectsSubsystem>())
     {
-        if (!BrakeLightVFX->IsActive())
-        {
-            BrakeLightVFX->Activate();
-        }
-        BrakeLightVFX->SetFloatParameter(FName("Intensity"), BrakeLightIntensity * CurrentBrake);
+        EffectsSubsystem->SetSignificance(this, Effective);
     }
-    else
+
+    const bool bCosmetics = Effective != EVehicleSignificance::Low;
+    if (bCosmetics == bCosmeticsActive) return;
+
+    bCosmeticsActive = bCosmetics;
+
+    // Effects, engine audio included, come back with the next effects update and voice selection
+    if (!bCosmetics)
     {
-        if (BrakeLightVFX->IsActive())
-        {
-            BrakeLightVFX->Deactivate();
-        }
+        DeactivateCosmetics();
     }
 }
 
-void AVehicleBase::UpdateTurnSignals(float DeltaTime)
+void AVehicleBase::Sleep()
 {
-    if (!TurnSignalVFX) return;
+    if (bSleeping) return;
 
-    if (bLeftTurnSignal || bRightTurnSignal)
+    bSleeping = true;
+    SetActorTickEnabled(false);
+    if (CachedMovement)
     {
-        if (!TurnSignalVFX->IsActive())
-        {
-            TurnSignalVFX->Activate();
-        }
-        
-        // Set direction parameter
-        TurnSignalVFX->SetFloatParameter(FName("Direction"), bLeftTurnSignal ? -1.0f : 1.0f);
+        CachedMovement->SetComponentTickEnabled(false);
     }
+    GetMesh()->PutAllRigidBodiesToSleep();
+    RefreshCosmetics();
 }
 
-void AVehicleBase::UpdateVehiclePhysics(float DeltaTime)
+void AVehicleBase::WakeUp()
 {
-    // Enhanced physics updates can go here
-    // Such as suspension effects, weight transfer, etc.
+    if (!bSleeping) return;
+
+    bSleeping = false;
+    LastDriveTime = GetWorld()->GetTimeSeconds();
+    if (CachedMovement)
+    {
+        CachedMovement->SetComponentTickEnabled(true);
+    }
+    GetMesh()->WakeAllRigidBodies();
+    RefreshCosmetics();
 }
 
-void AVehicleBase::UpdateCameraEffects(float DeltaTime)
+bool AVehicleBase::CanSleep() const
 {
-    // Camera shake based on speed and terrain
-    float Speed = GetVelocity().Size();
-    float CameraShake = FMath::Clamp(Speed / 1000.0f, 0.0f, 0.1f);
-    
-    // You can apply camera shake here
+    // Driverless, untouched for SleepDelay and at rest
+    return !bSleeping
+        && !GetController()
+        && GetWorld()->GetTimeSeconds() - LastDriveTime >= SleepDelay
+        && GetVelocity().SizeSquared() < FMath::Square(SleepSpeedThreshold);
 }
 
-void AVehicleBase::PlayTireScreechSound()
+void AVehicleBase::OnAcquiredFromPool()
 {
-    if (TireScreechAudio && !TireScreechAudio->IsPlaying())
+    SetActorHiddenInGame(false);
+    SetActorEnableCollision(true);
+    LastDriveTime = GetWorld()->GetTimeSeconds();
+
+    // Same state BeginPlay leaves a fresh spawn in
+    USkeletalMeshComponent* VehicleMesh = GetMesh();
+    VehicleMesh->SetSimulatePhysics(true);
+    if (bStartAsleep)
     {
-        TireScreechAudio->Play();
+        VehicleMesh->PutAllRigidBodiesToSleep();
+    }
+    else
+    {
+        WakeUp();
     }
 }
 
-void AVehicleBase::StopTireScreechSound()
+void AVehicleBase::OnReleasedToPool()
 {
-    if (TireScreechAudio && TireScreechAudio->IsPlaying())
+    ensureMsgf(!GetController(), TEXT("%s released to the pool while possessed"), *GetName());
+
+    ReleaseControls();
+    HornReleased();
+    ReleaseDriverComponents();
+    bLightsOn = false;
+    bLeftTurnSignal = false;
+    bRightTurnSignal = false;
+    TurnSignalOnTime = 0.0;
+    bBrakePressed = false;
+    Telemetry.Reset();
+
+    if (UVehicleEffectsSubsystem* EffectsSubsystem = GetWorld()->GetSubsystem<UVehicleEffectsSubsystem>())
     {
-        TireScreechAudio->Stop();
+        EffectsSubsystem->ResetVehicle(this);
     }
+
+    Sleep();
+    SetActorHiddenInGame(true);
+    SetActorEnableCollision(false);
+    GetMesh()->SetSimulatePhysics(false);
 }
 
-void AVehicleBase::OnEngineSoundUpdate(float Value)
+void AVehicleBase::NotifyHit(UPrimitiveComponent* MyComp, AActor* Other, UPrimitiveComponent* OtherComp, bool bSelfMoved, FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit)
 {
-    // Timeline callback for engine sound variations
-    if (EngineAudio)
-    {
-        EngineAudio->SetFloatParameter(FName("TimelineValue"), Value);
-    }
+    Super::NotifyHit(MyComp, Other, OtherComp, bSelfMoved, HitLocation, HitNormal, NormalImpulse, Hit);
+
+    WakeUp();
+}
+
+float AVehicleBase::GetEngineRPM() const
+{
+    const UVehicleEffectsSubsystem* EffectsSubsystem = GetWorld()->GetSubsystem<UVehicleEffectsSubsystem>();
+    return EffectsSubsystem ? EffectsSubsystem->GetEngineRPM(this) : EngineIdleRPM;
 }
 
-void AVehicleBase::OnExhaustVFXUpdate(float Value)
+void AVehicleBase::DeactivateCosmetics()
 {
-    // Timeline callback for exhaust VFX variations
-    if (ExhaustVFX && ExhaustVFX->IsActive())
+    for (UNiagaraComponent* VFX : { ExhaustVFX, TireSmokeVFX, BrakeLightVFX, TurnSignalVFX })
+    {
+        if (VFX)
+        {
+            VFX->Deactivate();
+        }
+    }
+
+    // Engine audio is stopped by UVehicleEffectsSubsystem when the engine voice is virtualized
+    for (UAudioComponent* Audio : { HornAudio, BrakeAudio, TireScreechAudio })
     {
-        ExhaustVFX->SetFloatParameter(FName("TimelineValue"), Value);
+        if (Audio)
+        {
+            Audio->Stop();
+        }
     }
 }
 
-void AVehicleBase::OnTurnSignalUpdate(float Value)
+void AVehicleBase::SetHeadlightEmissive(bool bOn)
+{
+    GetMesh()->SetCustomPrimitiveDataFloat(HeadlightEmissiveDataIndex, bOn ? HeadlightEmissive : 0.0f);
+}
+
+void AVehicleBase::CreateDriverComponents()
+{
+    if (VehicleCamera) return;
+
+    SCOPE_CYCLE_COUNTER(STAT_VehicleCreateDriverComponents);
+
+    // Enhanced Spring Arm for Vehicle Camera
+    VehicleSpringArm = NewObject<USpringArmComponent>(this);
+    VehicleSpringArm->SetupAttachment(RootComponent);
+    VehicleSpringArm->TargetArmLength = CameraDistance;
+    VehicleSpringArm->SetRelativeLocation(FVector(0.0f, 0.0f, CameraHeight));
+    VehicleSpringArm->bUsePawnControlRotation = true;
+    VehicleSpringArm->bEnableCameraLag = true;
+    VehicleSpringArm->CameraLagSpeed = CameraLagSpeed;
+    VehicleSpringArm->CameraRotationLagSpeed = 3.0f;
+    VehicleSpringArm->CameraLagMaxDistance = 100.0f;
+    VehicleSpringArm->bDoCollisionTest = true;
+    VehicleSpringArm->ProbeSize = 15.0f;
+    VehicleSpringArm->RegisterComponent();
+
+    // Vehicle Camera
+    VehicleCamera = NewObject<UCameraComponent>(this);
+    VehicleCamera->SetupAttachment(VehicleSpringArm);
+    VehicleCamera->bUsePawnControlRotation = false;
+    VehicleCamera->FieldOfView = 85.0f;
+    VehicleCamera->RegisterComponent();
+
+    HornAudio = CreateDriverAudio(HornSound);
+    BrakeAudio = CreateDriverAudio(BrakeSound);
+    TireScreechAudio = CreateDriverAudio(TireScreechSound);
+
+    TurnSignalVFX = NewObject<UNiagaraComponent>(this);
+    TurnSignalVFX->SetupAttachment(RootComponent);
+    TurnSignalVFX->SetAsset(TurnSignalSystem);
+    TurnSignalVFX->SetAutoActivate(false);
+    TurnSignalVFX->RegisterComponent();
+
+    INC_DWORD_STAT(STAT_VehicleDriverComponentSets);
+}
+
+UAudioComponent* AVehicleBase::CreateDriverAudio(USoundBase* Sound)
+{
+    UAudioComponent* Audio = NewObject<UAudioComponent>(this);
+    Audio->SetupAttachment(RootComponent);
+    Audio->SetSound(Sound);
+    Audio->bAutoActivate = false;
+    Audio->RegisterComponent();
+    return Audio;
+}
+
+void AVehicleBase::ReleaseDriverComponents()
 {
-    // Timeline callback for turn signal blinking
-    if (TurnSignalVFX && TurnSignalVFX->IsActive())
+    if (!VehicleCamera) return;
+
+    // Children before their attach parent
+    for (UActorComponent* Component : TArray<UActorComponent*>{ VehicleCamera, VehicleSpringArm, HornAudio, BrakeAudio, TireScreechAudio, TurnSignalVFX })
     {
-        TurnSignalVFX->SetFloatParameter(FName("BlinkValue"), Value);
+        if (Component)
+        {
+            Component->DestroyComponent();
+        }
     }
+
+    VehicleCamera = nullptr;
+    VehicleSpringArm = nullptr;
+    HornAudio = nullptr;
+    BrakeAudio = nullptr;
+    TireScreechAudio = nullptr;
+    TurnSignalVFX = nullptr;
+    bBrakePressed = false;
+
+    DEC_DWORD_STAT(STAT_VehicleDriverComponentSets);
 }
 
 void AVehicleBase::OnEnteredVehicle(ACityCharacter* Driver) 
 {
+    // The driven vehicle is awake and always gets full fidelity
+    WakeUp();
+    SetSignificance(EVehicleSignificance::High);
+    CreateDriverComponents();
+
     // Enhanced vehicle entry effects
     if (Driver)
     {
@@ -457,6 +716,16 @@ void AVehicleBase::OnEnteredVehicle(ACityCharacter* Driver)
 
 void AVehicleBase::OnExitedVehicle(ACityCharacter* Driver)  
 {
+    // Parked vehicles keep no signals running
+    bLeftTurnSignal = false;
+    bRightTurnSignal = false;
+    ReleaseDriverComponents();
+
+    if (UVehicleSignificanceSubsystem* SignificanceSubsystem = GetWorld()->GetSubsystem<UVehicleSignificanceSubsystem>())
+    {
+        SignificanceSubsystem->RequestUpdate();
+    }
+
     // Enhanced vehicle exit effects
     if (Driver)
     {
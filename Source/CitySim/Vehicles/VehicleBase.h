@@ -1,21 +1,78 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "ChaosWheeledVehiclePawn.h"
+#include "Vehicles/VehicleSignificanceSubsystem.h"
+#include "Vehicles/VehicleTelemetry.h"
+#include "ActorPoolSubsystem.h"
 #include "VehicleBase.generated.h"
 
+DECLARE_STATS_GROUP(TEXT("Vehicles"), STATGROUP_Vehicles, STATCAT_Advanced);
+
+class UChaosVehicleMovementComponent;
+
+// One frame of driver input. Filled by the player's axis bindings, an AI driver or a replay.
+USTRUCT(BlueprintType)
+struct FVehicleInputFrame
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+    float Throttle = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+    float Steer = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+    float Brake = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Input")
+    bool bHandbrake = false;
+
+    // Nobody driving; a held handbrake alone doesn't count
+    bool IsIdle() const { return Throttle == 0.0f && Steer == 0.0f && Brake == 0.0f; }
+
+    bool operator==(const FVehicleInputFrame& Other) const
+    {
+        return Throttle == Other.Throttle && Steer == Other.Steer && Brake == Other.Brake && bHandbrake == Other.bHandbrake;
+    }
+};
+
+// Input smoothing rates; Step moves Current toward Target the same way for any caller
+struct FVehicleInputSmoothing
+{
+    float ThrottleSpeed = 3.0f;
+    float SteerSpeed = 5.0f;
+    float BrakeSpeed = 4.0f;
+
+    void Step(FVehicleInputFrame& Current, const FVehicleInputFrame& Target, float DeltaTime) const;
+};
+
+// Splits variable frame times into whole fixed steps, carrying the remainder to the next frame
+struct FVehicleInputStepper
+{
+    float StepSize = 1.0f / 60.0f;
+    float Accumulator = 0.0f;
+
+    // Steps due after DeltaTime more seconds; capped so a hitch can't queue up a burst of steps
+    int32 Advance(float DeltaTime);
+};
+
 class ACityCharacter;
 class UNiagaraComponent;
 class UAudioComponent;
 class UCurveFloat;
-class UTimelineComponent;
+class USpringArmComponent;
+class UCameraComponent;
+class USoundBase;
+class UNiagaraSystem;
 
 UCLASS()
-class BELIVE_API AVehicleBase : public AChaosWheeledVehiclePawn
+class BELIVE_API AVehicleBase : public AChaosWheeledVehiclePawn, public IPoolableActor
 {
     GENERATED_BODY()
 
 public:
-    AVehicleBase();
+    AVehicleBase(const FObjectInitializer& ObjectInitializer);
 
     UPROPERTY(EditAnywhere, Category = "Vehicle")
     float MaxThrottle = 1.0f;
@@ -47,6 +104,7 @@ public:
     UPROPERTY(EditAnywhere, Category = "Vehicle")
     float CameraLagSpeed = 2.0f;
 
+    // Looped over their key range and sampled by UVehicleEffectsSubsystem
     UPROPERTY(EditAnywhere, Category = "Vehicle")
     UCurveFloat* EngineSoundCurve;
 
@@ -65,12 +123,82 @@ public:
     UPROPERTY(EditAnywhere, Category = "Vehicle")
     float BrakeLightIntensity = 2.0f;
 
+    // Blinks per second
     UPROPERTY(EditAnywhere, Category = "Vehicle")
     float TurnSignalBlinkRate = 1.0f;
 
+    // Headlight glow, written to this custom primitive data slot of the mesh whenever the lights
+    // change. The material reads it with a Custom Primitive Data node, so lit vehicles keep
+    // sharing their material instances instead of each getting dynamic ones.
+    UPROPERTY(EditAnywhere, Category = "Lights", meta = (ClampMin = "0"))
+    int32 HeadlightEmissiveDataIndex = 0;
+
+    UPROPERTY(EditAnywhere, Category = "Lights")
+    float HeadlightEmissive = 10.0f;
+
+    // Spot light used when the vehicle wins one from the headlight budget, relative to the mesh
+    UPROPERTY(EditAnywhere, Category = "Lights")
+    FVector HeadlightOffset = FVector(220.0f, 0.0f, 60.0f);
+
+    UPROPERTY(EditAnywhere, Category = "Lights")
+    float HeadlightIntensity = 8000.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Lights")
+    float HeadlightAttenuationRadius = 4000.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Lights")
+    float HeadlightConeAngle = 40.0f;
+
+    // Assets for the driver-only components created in OnEnteredVehicle
+    UPROPERTY(EditAnywhere, Category = "Audio")
+    USoundBase* HornSound = nullptr;
+
+    UPROPERTY(EditAnywhere, Category = "Audio")
+    USoundBase* BrakeSound = nullptr;
+
+    UPROPERTY(EditAnywhere, Category = "Audio")
+    USoundBase* TireScreechSound = nullptr;
+
+    UPROPERTY(EditAnywhere, Category = "Effects")
+    UNiagaraSystem* TurnSignalSystem = nullptr;
+
+    // Seconds between cosmetic updates while at medium significance
+    UPROPERTY(EditAnywhere, Category = "Performance")
+    float ReducedCosmeticTickInterval = 0.1f;
+
+    // Placed vehicles sleep (no tick, audio, Niagara or awake rigid body) until someone comes near
+    UPROPERTY(EditAnywhere, Category = "Performance")
+    bool bStartAsleep = true;
+
+    // Seconds a driverless vehicle must sit at rest before it goes back to sleep
+    UPROPERTY(EditAnywhere, Category = "Performance")
+    float SleepDelay = 5.0f;
+
+    UPROPERTY(EditAnywhere, Category = "Performance")
+    float SleepSpeedThreshold = 10.0f;
+
+    // Smooth input on the physics thread once per physics step instead of once per frame, so
+    // handling doesn't change with frame rate. Only takes effect with bTickPhysicsAsync, where
+    // several fixed steps can run per frame; synchronous physics steps once per frame anyway.
+    UPROPERTY(EditAnywhere, Category = "Physics")
+    bool bFixedStepInput = false;
+
     virtual void SetupPlayerInputComponent(UInputComponent* IC) override;
     virtual void Tick(float DeltaTime) override;
 
+    // Raw input for this frame from an AI driver or replay; smoothed and applied in Tick
+    UFUNCTION(BlueprintCallable, Category = "Vehicle")
+    void SetInputFrame(const FVehicleInputFrame& Input);
+
+    FVehicleInputSmoothing GetInputSmoothing() const;
+
+    // Raw input as last received, and the smoothed values sent to the movement component
+    const FVehicleInputFrame& GetRawInput() const { return RawInput; }
+    FVehicleInputFrame GetSmoothedInput() const;
+
+    // Lets go of every control at once, e.g. when the driver or traffic AI hands the vehicle back
+    void ReleaseControls();
+
     void Throttle(float Value);
     void Steer(float Value);
     void Brake(float Value);
@@ -85,10 +213,37 @@ public:
     void OnEnteredVehicle(class ACityCharacter* Driver);
     void OnExitedVehicle(class ACityCharacter* Driver);
 
+    // Set by UVehicleSignificanceSubsystem
+    void SetSignificance(EVehicleSignificance NewSignificance);
+    EVehicleSignificance GetSignificance() const { return Significance; }
+
+    float GetEngineRPM() const;
+
+    // Writes the frames recorded while this vehicle was driven; false if there are none
+    bool FlushTelemetry(const FString& Path, bool bReset = false);
+
+    // Parked vehicle sleep; woken by nearby characters, getting in, input or collisions
+    void Sleep();
+    void WakeUp();
+    bool IsSleeping() const { return bSleeping; }
+    bool CanSleep() const;
+
+    // Pooled vehicles come back parked and asleep, with lights, signals, horn and RPM reset
+    virtual void OnAcquiredFromPool() override;
+    virtual void OnReleasedToPool() override;
+
+    virtual void NotifyHit(UPrimitiveComponent* MyComp, AActor* Other, UPrimitiveComponent* OtherComp, bool bSelfMoved, FVector HitLocation, FVector HitNormal, FVector NormalImpulse, const FHitResult& Hit) override;
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void PossessedBy(AController* NewController) override;
+    virtual void UnPossessed() override;
 
 private:
+    friend class UVehicleEffectsSubsystem;
+    friend class FVehicleEffectsCostTest;
+
     // Visual Effects
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Effects", meta = (AllowPrivateAccess = "true"))
     UNiagaraComponent* ExhaustVFX;
@@ -99,64 +254,67 @@ private:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Effects", meta = (AllowPrivateAccess = "true"))
     UNiagaraComponent* BrakeLightVFX;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Effects", meta = (AllowPrivateAccess = "true"))
-    UNiagaraComponent* TurnSignalVFX;
-
     // Audio Components
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Audio", meta = (AllowPrivateAccess = "true"))
     UAudioComponent* EngineAudio;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Audio", meta = (AllowPrivateAccess = "true"))
-    UAudioComponent* HornAudio;
+    // Driver-only components; null unless someone is driving
+    UPROPERTY(Transient)
+    USpringArmComponent* VehicleSpringArm = nullptr;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Audio", meta = (AllowPrivateAccess = "true"))
-    UAudioComponent* BrakeAudio;
+    UPROPERTY(Transient)
+    UCameraComponent* VehicleCamera = nullptr;
 
-    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Audio", meta = (AllowPrivateAccess = "true"))
-    UAudioComponent* TireScreechAudio;
+    UPROPERTY(Transient)
+    UNiagaraComponent* TurnSignalVFX = nullptr;
 
-    // Timelines
-    UPROPERTY()
-    UTimelineComponent* EngineSoundTimeline;
+    UPROPERTY(Transient)
+    UAudioComponent* HornAudio = nullptr;
 
-    UPROPERTY()
-    UTimelineComponent* ExhaustVFXTimeline;
+    UPROPERTY(Transient)
+    UAudioComponent* BrakeAudio = nullptr;
+
+    UPROPERTY(Transient)
+    UAudioComponent* TireScreechAudio = nullptr;
+
+    // Input
+    FVehicleInputFrame RawInput;
+    FVehicleInputStepper InputStepper;
 
     UPROPERTY()
-    UTimelineComponent* TurnSignalTimeline;
+    UChaosVehicleMovementComponent* CachedMovement = nullptr;
 
     // State Variables
     float CurrentThrottle = 0.0f;
     float CurrentSteering = 0.0f;
     float CurrentBrake = 0.0f;
-    float CurrentEngineRPM = 0.0f;
     bool bHornPressed = false;
     bool bLightsOn = false;
     bool bLeftTurnSignal = false;
     bool bRightTurnSignal = false;
+    double TurnSignalOnTime = 0.0; // Blink phase origin for UVehicleEffectsSubsystem
     bool bBrakePressed = false;
     bool bHandbrakePressed = false;
-    float LastSpeed = 0.0f;
     FVector LastLocation = FVector::ZeroVector;
+    EVehicleSignificance Significance = EVehicleSignificance::High;
+    int32 EffectsHandle = INDEX_NONE; // Slot in UVehicleEffectsSubsystem
+    bool bSleeping = false;
+    bool bCosmeticsActive = false;
+    double LastDriveTime = 0.0;
+    FVehicleTelemetryRing Telemetry; // Allocated the first time the vehicle is driven
 
     // Enhanced Functions
-    void UpdateEngineSound(float DeltaTime);
-    void UpdateExhaustVFX(float DeltaTime);
-    void UpdateTireSmoke(float DeltaTime);
-    void UpdateBrakeLights();
-    void UpdateTurnSignals(float DeltaTime);
+    void ProcessInput(float DeltaTime);
+    void ApplyMovementInput(const FVehicleInputFrame& Input);
     void UpdateVehiclePhysics(float DeltaTime);
     void UpdateCameraEffects(float DeltaTime);
+    void RecordTelemetry(float DeltaTime);
     void PlayTireScreechSound();
     void StopTireScreechSound();
-
-    // Timeline Callbacks
-    UFUNCTION()
-    void OnEngineSoundUpdate(float Value);
-
-    UFUNCTION()
-    void OnExhaustVFXUpdate(float Value);
-
-    UFUNCTION()
-    void OnTurnSignalUpdate(float Value);
+    void CreateDriverComponents();
+    UAudioComponent* CreateDriverAudio(USoundBase* Sound);
+    void ReleaseDriverComponents();
+    void RefreshCosmetics();
+    void DeactivateCosmetics();
+    void SetHeadlightEmissive(bool bOn);
 };
@@ -0,0 +1,669 @@
+#include "Vehicles/VehicleEffectsSubsystem.h"
+#include "Vehicles/VehicleBase.h"
+#include "ChaosWheeledVehicleMovementComponent.h"
+#include "NiagaraComponent.h"
+#include "Components/AudioComponent.h"
+#include "Curves/CurveFloat.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "AudioDevice.h"
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+DECLARE_CYCLE_STAT(TEXT("Vehicle Effects Gather"), STAT_VehicleEffectsGather, STATGROUP_Vehicles);
+DECLARE_CYCLE_STAT(TEXT("Vehicle Effects Compute"), STAT_VehicleEffectsCompute, STATGROUP_Vehicles);
+DECLARE_CYCLE_STAT(TEXT("Vehicle Effects Apply"), STAT_VehicleEffectsApply, STATGROUP_Vehicles);
+DECLARE_CYCLE_STAT(TEXT("Vehicle Engine Voice Selection"), STAT_VehicleEngineVoiceSelection, STATGROUP_Vehicles);
+DECLARE_CYCLE_STAT(TEXT("Vehicle Headlight Selection"), STAT_VehicleHeadlightSelection, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicle Effects Updated"), STAT_VehicleEffectsUpdated, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicle Engine Voices Active"), STAT_VehicleEngineVoicesActive, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicle Engine Voices Virtual"), STAT_VehicleEngineVoicesVirtual, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicle Engine Parameter Sends"), STAT_VehicleEngineParameterSends, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Skid Mark Segments"), STAT_SkidMarkSegments, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicle Headlights On"), STAT_VehicleHeadlightsOn, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicle Headlight Spot Lights"), STAT_VehicleHeadlightSpotLights, STATGROUP_Vehicles);
+
+static TAutoConsoleVariable<bool> CVarVehicleEffectsParallel(
+    TEXT("Vehicle.Effects.Parallel"), true,
+    TEXT("Spread the vehicle effects math across worker threads."));
+
+static TAutoConsoleVariable<int32> CVarVehicleAudioMaxEngineVoices(
+    TEXT("Vehicle.Audio.MaxEngineVoices"), 16,
+    TEXT("Engine loops allowed to play at once; the most audible vehicles get them and the rest are virtualized."));
+
+static TAutoConsoleVariable<float> CVarVehicleAudioSelectInterval(
+    TEXT("Vehicle.Audio.SelectInterval"), 0.2f,
+    TEXT("Seconds between re-ranking vehicle engines by audibility."));
+
+static TAutoConsoleVariable<int32> CVarVehicleHeadlightBudget(
+    TEXT("Vehicle.Headlights.Budget"), 8,
+    TEXT("Real spot lights shared by vehicle headlights; the rest of the vehicles with lights on only glow."));
+
+static TAutoConsoleVariable<float> CVarVehicleHeadlightSelectInterval(
+    TEXT("Vehicle.Headlights.SelectInterval"), 0.5f,
+    TEXT("Seconds between re-ranking vehicles with their lights on for the headlight budget."));
+
+static TAutoConsoleVariable<float> CVarVehicleHeadlightMaxDistance(
+    TEXT("Vehicle.Headlights.MaxDistance"), 10000.0f,
+    TEXT("Vehicles further than this from the camera never get a real headlight."));
+
+static TAutoConsoleVariable<bool> CVarVehicleSkidMarks(
+    TEXT("Vehicle.SkidMarks.Enable"), true,
+    TEXT("Lay skid marks under the wheels of high significance vehicles showing tire smoke."));
+
+// Distance (cm) at which a vehicle's claim to a headlight halves
+static constexpr float HeadlightReferenceDistance = 2500.0f;
+
+// Vehicles per ParallelFor batch; below this the pass stays on one thread
+static constexpr int32 EffectsBatchSize = 64;
+
+void FVehicleLoopingCurve::Set(const FRichCurve* InCurve)
+{
+    Curve = InCurve && InCurve->GetNumKeys() > 0 ? InCurve : nullptr;
+    StartTime = 0.0f;
+    Period = 0.0f;
+    if (Curve)
+    {
+        float EndTime = 0.0f;
+        Curve->GetTimeRange(StartTime, EndTime);
+        Period = EndTime - StartTime;
+    }
+}
+
+float FVehicleLoopingCurve::Sample(double Time) const
+{
+    if (!Curve) return 0.0f;
+
+    const float Position = Period > KINDA_SMALL_NUMBER ? static_cast<float>(FMath::Fmod(Time, static_cast<double>(Period))) : 0.0f;
+    return Curve->Eval(StartTime + Position);
+}
+
+int32 FVehicleEffectsState::Add(const FVehicleEffectsTuning& InTuning)
+{
+    Tuning.Add(InTuning);
+    Significance.Add(EVehicleSignificance::High);
+    TimeSinceUpdate.Add(0.0f);
+    DeltaTime.Add(0.0f);
+    Throttle.Add(0.0f);
+    Brake.Add(0.0f);
+    Speed.Add(0.0f);
+    LastSpeed.Add(0.0f);
+    EngineRPM.Add(InTuning.EngineIdleRPM);
+    ExhaustIntensity.Add(0.0f);
+    BrakeLightIntensity.Add(0.0f);
+    PhaseOffset.Add(0.0f);
+    TurnSignalOnTime.Add(0.0);
+    EngineSoundModulation.Add(0.0f);
+    ExhaustVFXModulation.Add(0.0f);
+    TurnSignalBlink.Add(0.0f);
+    AppliedFlags.Add(EVehicleEffectFlags::None);
+    return Flags.Add(EVehicleEffectFlags::None);
+}
+
+void FVehicleEffectsState::RemoveAtSwap(int32 Index)
+{
+    Tuning.RemoveAtSwap(Index);
+    Significance.RemoveAtSwap(Index);
+    TimeSinceUpdate.RemoveAtSwap(Index);
+    DeltaTime.RemoveAtSwap(Index);
+    Throttle.RemoveAtSwap(Index);
+    Brake.RemoveAtSwap(Index);
+    Speed.RemoveAtSwap(Index);
+    LastSpeed.RemoveAtSwap(Index);
+    EngineRPM.RemoveAtSwap(Index);
+    ExhaustIntensity.RemoveAtSwap(Index);
+    BrakeLightIntensity.RemoveAtSwap(Index);
+    PhaseOffset.RemoveAtSwap(Index);
+    TurnSignalOnTime.RemoveAtSwap(Index);
+    EngineSoundModulation.RemoveAtSwap(Index);
+    ExhaustVFXModulation.RemoveAtSwap(Index);
+    TurnSignalBlink.RemoveAtSwap(Index);
+    AppliedFlags.RemoveAtSwap(Index);
+    Flags.RemoveAtSwap(Index);
+}
+
+void FVehicleEffectsState::Compute(FVehicleEffectsState& State, TConstArrayView<int32> Indices, double Time, bool bParallel)
+{
+    ParallelFor(TEXT("VehicleEffects"), Indices.Num(), EffectsBatchSize, [&State, Indices, Time](int32 Item)
+    {
+        const int32 Index = Indices[Item];
+        const FVehicleEffectsTuning& Tune = State.Tuning[Index];
+        const float DT = FMath::Max(State.DeltaTime[Index], KINDA_SMALL_NUMBER);
+        const float Throttle = FMath::Abs(State.Throttle[Index]);
+        const float Brake = State.Brake[Index];
+        const float Speed = State.Speed[Index];
+        EVehicleEffectFlags Flags = State.Flags[Index] & EVehicleEffectFlags::Inputs;
+
+        // Engine RPM from throttle and speed
+        float TargetRPM = Tune.EngineIdleRPM + (Tune.MaxEngineRPM - Tune.EngineIdleRPM) * Throttle;
+        TargetRPM = FMath::Clamp(TargetRPM + Speed * 10.0f, Tune.EngineIdleRPM, Tune.MaxEngineRPM);
+        State.EngineRPM[Index] = FMath::FInterpTo(State.EngineRPM[Index], TargetRPM, DT, 2.0f);
+
+        State.ExhaustIntensity[Index] = Throttle * Tune.ExhaustVFXIntensity;
+        if (State.ExhaustIntensity[Index] > 0.1f)
+        {
+            Flags |= EVehicleEffectFlags::Exhaust;
+        }
+
+        // Hard braking, hard acceleration or a handbrake slide
+        const float Acceleration = (Speed - State.LastSpeed[Index]) / DT;
+        const bool bHandbrake = EnumHasAnyFlags(Flags, EVehicleEffectFlags::Handbrake);
+        if (FMath::Abs(Brake) > Tune.TireSmokeThreshold || FMath::Abs(Acceleration) > 500.0f || (bHandbrake && Speed > 100.0f))
+        {
+            Flags |= EVehicleEffectFlags::TireSmoke;
+        }
+        State.LastSpeed[Index] = Speed;
+
+        State.BrakeLightIntensity[Index] = Tune.BrakeLightIntensity * Brake;
+        if (Brake > 0.1f || bHandbrake)
+        {
+            Flags |= EVehicleEffectFlags::BrakeLight;
+        }
+
+        // Curve phases come straight from world time, so skipped updates need no catching up
+        const double Phase = Time + State.PhaseOffset[Index];
+        State.EngineSoundModulation[Index] = Tune.EngineSoundCurve.Sample(Phase);
+        State.ExhaustVFXModulation[Index] = Tune.ExhaustVFXCurve.Sample(Phase);
+
+        // Square wave from the moment the signal went on, so the first blink is lit
+        State.TurnSignalBlink[Index] = 0.0f;
+        if (EnumHasAnyFlags(Flags, EVehicleEffectFlags::LeftSignal | EVehicleEffectFlags::RightSignal))
+        {
+            Flags |= EVehicleEffectFlags::TurnSignal;
+            const double Cycles = (Time - State.TurnSignalOnTime[Index]) * Tune.TurnSignalBlinkRate;
+            State.TurnSignalBlink[Index] = FMath::Frac(Cycles) < 0.5 ? 1.0f : 0.0f;
+        }
+
+        State.Flags[Index] = Flags;
+    }, bParallel ? EParallelForFlags::None : EParallelForFlags::ForceSingleThread);
+}
+
+void UVehicleEffectsSubsystem::RegisterVehicle(AVehicleBase* Vehicle)
+{
+    if (!Vehicle || Vehicle->EffectsHandle != INDEX_NONE) return;
+
+    FVehicleEffectsTuning Tuning;
+    Tuning.EngineIdleRPM = Vehicle->EngineIdleRPM;
+    Tuning.MaxEngineRPM = Vehicle->MaxEngineRPM;
+    Tuning.ExhaustVFXIntensity = Vehicle->ExhaustVFXIntensity;
+    Tuning.TireSmokeThreshold = Vehicle->TireSmokeThreshold;
+    Tuning.BrakeLightIntensity = Vehicle->BrakeLightIntensity;
+    Tuning.ReducedUpdateInterval = Vehicle->ReducedCosmeticTickInterval;
+    Tuning.TurnSignalBlinkRate = Vehicle->TurnSignalBlinkRate;
+    Tuning.EngineSoundCurve.Set(Vehicle->EngineSoundCurve ? &Vehicle->EngineSoundCurve->FloatCurve : nullptr);
+    Tuning.ExhaustVFXCurve.Set(Vehicle->ExhaustVFXCurve ? &Vehicle->ExhaustVFXCurve->FloatCurve : nullptr);
+
+    const int32 Index = State.Add(Tuning);
+    EngineVoices.Add(Vehicle->EngineAudio);
+
+    FVehicleHeadlightMount HeadlightMount;
+    HeadlightMount.Parent = Vehicle->GetMesh();
+    HeadlightMount.Offset = Vehicle->HeadlightOffset;
+    HeadlightMount.Intensity = Vehicle->HeadlightIntensity;
+    HeadlightMount.AttenuationRadius = Vehicle->HeadlightAttenuationRadius;
+    HeadlightMount.OuterConeAngle = Vehicle->HeadlightConeAngle;
+    Headlights.Add(HeadlightMount);
+    SkidTrails.AddDefaulted();
+    State.Significance[Index] = Vehicle->GetSignificance();
+    State.LastSpeed[Index] = Vehicle->GetVelocity().Size();
+    State.PhaseOffset[Index] = FMath::FRandRange(0.0f, FMath::Max(Tuning.EngineSoundCurve.Period, Tuning.ExhaustVFXCurve.Period));
+    Vehicles.Add(Vehicle);
+    Vehicle->EffectsHandle = Index;
+}
+
+void UVehicleEffectsSubsystem::UnregisterVehicle(AVehicleBase* Vehicle)
+{
+    const int32 Index = Vehicle ? Vehicle->EffectsHandle : INDEX_NONE;
+    if (!Vehicles.IsValidIndex(Index) || Vehicles[Index] != Vehicle) return;
+
+    State.RemoveAtSwap(Index);
+    EngineVoices.RemoveAtSwap(Index);
+    Headlights.RemoveAtSwap(Index);
+    SkidTrails.RemoveAtSwap(Index);
+    Vehicles.RemoveAtSwap(Index);
+    if (Vehicles.IsValidIndex(Index) && Vehicles[Index])
+    {
+        Vehicles[Index]->EffectsHandle = Index;
+    }
+    Vehicle->EffectsHandle = INDEX_NONE;
+}
+
+void UVehicleEffectsSubsystem::SetSignificance(AVehicleBase* Vehicle, EVehicleSignificance Significance)
+{
+    const int32 Index = Vehicle ? Vehicle->EffectsHandle : INDEX_NONE;
+    if (!Vehicles.IsValidIndex(Index)) return;
+
+    const EVehicleSignificance OldSignificance = State.Significance[Index];
+    State.Significance[Index] = Significance;
+
+    if (Significance == EVehicleSignificance::Low)
+    {
+        // The vehicle shuts its components down; everything is re-applied when it comes back
+        State.AppliedFlags[Index] = EVehicleEffectFlags::None;
+        EngineVoices.Virtualize(Index);
+        Headlights.Release(Index);
+        SkidTrails[Index].Reset();
+    }
+    else if (OldSignificance == EVehicleSignificance::Low)
+    {
+        // Speed changed while we weren't looking; don't read the gap as hard acceleration
+        State.LastSpeed[Index] = Vehicle->GetVelocity().Size();
+        State.TimeSinceUpdate[Index] = 0.0f;
+    }
+}
+
+void UVehicleEffectsSubsystem::ResetVehicle(AVehicleBase* Vehicle)
+{
+    const int32 Index = Vehicle ? Vehicle->EffectsHandle : INDEX_NONE;
+    if (!Vehicles.IsValidIndex(Index)) return;
+
+    State.Throttle[Index] = 0.0f;
+    State.Brake[Index] = 0.0f;
+    State.Speed[Index] = 0.0f;
+    State.LastSpeed[Index] = 0.0f;
+    State.EngineRPM[Index] = State.Tuning[Index].EngineIdleRPM;
+    State.ExhaustIntensity[Index] = 0.0f;
+    State.BrakeLightIntensity[Index] = 0.0f;
+    State.TurnSignalOnTime[Index] = 0.0;
+    State.TurnSignalBlink[Index] = 0.0f;
+    State.TimeSinceUpdate[Index] = 0.0f;
+    State.Flags[Index] = EVehicleEffectFlags::None;
+    State.AppliedFlags[Index] = EVehicleEffectFlags::None;
+    EngineVoices.Virtualize(Index);
+    Headlights.Release(Index);
+    Vehicle->SetHeadlightEmissive(false);
+    SkidTrails[Index].Reset();
+}
+
+float UVehicleEffectsSubsystem::GetEngineRPM(const AVehicleBase* Vehicle) const
+{
+    const int32 Index = Vehicle ? Vehicle->EffectsHandle : INDEX_NONE;
+    return Vehicles.IsValidIndex(Index) ? State.EngineRPM[Index] : 0.0f;
+}
+
+EVehicleEffectFlags UVehicleEffectsSubsystem::GetEffectFlags(const AVehicleBase* Vehicle) const
+{
+    const int32 Index = Vehicle ? Vehicle->EffectsHandle : INDEX_NONE;
+    return Vehicles.IsValidIndex(Index) ? State.AppliedFlags[Index] : EVehicleEffectFlags::None;
+}
+
+void UVehicleEffectsSubsystem::RegisterSkidMarkManager(ASkidMarkManager* Manager)
+{
+    if (SkidMarks.IsValid() && SkidMarks.Get() != Manager)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Multiple skid mark managers registered, using %s"), *GetNameSafe(Manager));
+    }
+    SkidMarks = Manager;
+}
+
+void UVehicleEffectsSubsystem::UnregisterSkidMarkManager(ASkidMarkManager* Manager)
+{
+    if (SkidMarks.Get() != Manager) return;
+
+    SkidMarks.Reset();
+    for (FSkidMarkTrail& Trail : SkidTrails)
+    {
+        Trail.Reset();
+    }
+}
+
+void UVehicleEffectsSubsystem::Tick(float DeltaTime)
+{
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VehicleEffectsGather);
+        GatherInputs(DeltaTime);
+    }
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VehicleEffectsCompute);
+        FVehicleEffectsState::Compute(State, DueIndices, GetWorld()->GetTimeSeconds(), CVarVehicleEffectsParallel.GetValueOnGameThread());
+    }
+
+    TimeUntilVoiceSelection -= DeltaTime;
+    if (TimeUntilVoiceSelection <= 0.0f)
+    {
+        TimeUntilVoiceSelection = CVarVehicleAudioSelectInterval.GetValueOnGameThread();
+        SCOPE_CYCLE_COUNTER(STAT_VehicleEngineVoiceSelection);
+        SelectEngineVoices();
+    }
+
+    {
+        SCOPE_CYCLE_COUNTER(STAT_VehicleEffectsApply);
+        ApplyEffects();
+    }
+
+    // After apply, so lights just switched on are ranked this frame
+    TimeUntilHeadlightSelection -= DeltaTime;
+    if (TimeUntilHeadlightSelection <= 0.0f)
+    {
+        TimeUntilHeadlightSelection = CVarVehicleHeadlightSelectInterval.GetValueOnGameThread();
+        SCOPE_CYCLE_COUNTER(STAT_VehicleHeadlightSelection);
+        SelectHeadlights();
+    }
+    Headlights.Update(DeltaTime);
+
+    SET_DWORD_STAT(STAT_VehicleEffectsUpdated, DueIndices.Num());
+    SET_DWORD_STAT(STAT_VehicleEngineVoicesActive, EngineVoices.GetActiveVoiceCount());
+    SET_DWORD_STAT(STAT_VehicleEngineVoicesVirtual, EngineVoices.GetVirtualVoiceCount());
+    SET_DWORD_STAT(STAT_VehicleEngineParameterSends, EngineVoices.ConsumeParameterSends());
+    SET_DWORD_STAT(STAT_SkidMarkSegments, NumSkidSegments);
+    SET_DWORD_STAT(STAT_VehicleHeadlightSpotLights, Headlights.GetNumAssigned());
+}
+
+TStatId UVehicleEffectsSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UVehicleEffectsSubsystem, STATGROUP_Tickables);
+}
+
+void UVehicleEffectsSubsystem::GatherInputs(float DeltaTime)
+{
+    DueIndices.Reset();
+
+    for (int32 Index = 0; Index < Vehicles.Num(); ++Index)
+    {
+        const AVehicleBase* Vehicle = Vehicles[Index];
+        const EVehicleSignificance Significance = State.Significance[Index];
+        if (!Vehicle || Significance == EVehicleSignificance::Low) continue;
+
+        // Medium significance vehicles update at a reduced rate with the accumulated delta
+        State.TimeSinceUpdate[Index] += DeltaTime;
+        if (Significance == EVehicleSignificance::Medium && State.TimeSinceUpdate[Index] < State.Tuning[Index].ReducedUpdateInterval) continue;
+
+        State.DeltaTime[Index] = State.TimeSinceUpdate[Index];
+        State.TimeSinceUpdate[Index] = 0.0f;
+
+        // One velocity read per vehicle per update
+        State.Throttle[Index] = Vehicle->CurrentThrottle;
+        State.Brake[Index] = Vehicle->CurrentBrake;
+        State.TurnSignalOnTime[Index] = Vehicle->TurnSignalOnTime;
+        State.Speed[Index] = Vehicle->GetVelocity().Size();
+
+        EVehicleEffectFlags Inputs = EVehicleEffectFlags::None;
+        if (Vehicle->bHandbrakePressed) Inputs |= EVehicleEffectFlags::Handbrake;
+        if (Vehicle->bLeftTurnSignal) Inputs |= EVehicleEffectFlags::LeftSignal;
+        if (Vehicle->bRightTurnSignal) Inputs |= EVehicleEffectFlags::RightSignal;
+        if (Vehicle->bLightsOn) Inputs |= EVehicleEffectFlags::Lights;
+        State.Flags[Index] = Inputs;
+
+        DueIndices.Add(Index);
+    }
+}
+
+void UVehicleEffectsSubsystem::SelectEngineVoices()
+{
+    // Nobody to hear engines on a dedicated server or without an audio device
+    UWorld* World = GetWorld();
+    const APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(World, 0);
+    const bool bCanPlay = CameraManager && World->GetNetMode() != NM_DedicatedServer && World->GetAudioDevice().IsValid();
+    const FVector ListenerLocation = CameraManager ? CameraManager->GetCameraLocation() : FVector::ZeroVector;
+
+    EngineVoices.MaxVoices = CVarVehicleAudioMaxEngineVoices.GetValueOnGameThread();
+    const float ReferenceDistanceSq = FMath::Square(EngineVoices.ReferenceDistance);
+
+    for (int32 Index = 0; Index < Vehicles.Num(); ++Index)
+    {
+        const AVehicleBase* Vehicle = Vehicles[Index];
+        const UAudioComponent* Engine = Vehicle ? Vehicle->EngineAudio : nullptr;
+        if (!bCanPlay || !Engine || State.Significance[Index] == EVehicleSignificance::Low)
+        {
+            EngineVoices.SetAudibility(Index, 0.0f);
+            continue;
+        }
+
+        // Loudness falls off with the square of distance past the reference distance
+        const FVehicleEffectsTuning& Tune = State.Tuning[Index];
+        const float NormalizedRPM = (State.EngineRPM[Index] - Tune.EngineIdleRPM) / FMath::Max(Tune.MaxEngineRPM - Tune.EngineIdleRPM, 1.0f);
+        const float Loudness = FVehicleEngineAudioManager::GetLoudness(NormalizedRPM, State.Throttle[Index]) * Engine->VolumeMultiplier;
+        const float DistanceSq = FVector::DistSquared(Vehicle->GetActorLocation(), ListenerLocation);
+        EngineVoices.SetAudibility(Index, Loudness / (1.0f + DistanceSq / ReferenceDistanceSq));
+    }
+
+    EngineVoices.SelectVoices(bCanPlay);
+}
+
+void UVehicleEffectsSubsystem::SelectHeadlights()
+{
+    // Vehicles in front of the camera light what the player sees; those behind still count a little
+    const APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0);
+    const FVector CameraLocation = CameraManager ? CameraManager->GetCameraLocation() : FVector::ZeroVector;
+    const FVector CameraForward = CameraManager ? CameraManager->GetCameraRotation().Vector() : FVector::ForwardVector;
+    const float MaxDistanceSq = FMath::Square(CVarVehicleHeadlightMaxDistance.GetValueOnGameThread());
+    const float ReferenceDistanceSq = FMath::Square(HeadlightReferenceDistance);
+
+    int32 NumOn = 0;
+    for (int32 Index = 0; Index < Vehicles.Num(); ++Index)
+    {
+        const AVehicleBase* Vehicle = Vehicles[Index];
+        if (!Vehicle || !Vehicle->bLightsOn || State.Significance[Index] == EVehicleSignificance::Low)
+        {
+            Headlights.SetScore(Index, 0.0f);
+            continue;
+        }
+
+        ++NumOn;
+        const FVector ToVehicle = Vehicle->GetActorLocation() - CameraLocation;
+        const float DistanceSq = ToVehicle.SizeSquared();
+        if (!CameraManager || DistanceSq > MaxDistanceSq)
+        {
+            Headlights.SetScore(Index, 0.0f);
+            continue;
+        }
+
+        const float Facing = FMath::Max(FVector::DotProduct(CameraForward, ToVehicle.GetSafeNormal()), 0.0f);
+        Headlights.SetScore(Index, (0.25f + 0.75f * Facing) / (1.0f + DistanceSq / ReferenceDistanceSq));
+    }
+
+    Headlights.MaxLights = CVarVehicleHeadlightBudget.GetValueOnGameThread();
+    Headlights.SelectLights(GetWorld());
+    SET_DWORD_STAT(STAT_VehicleHeadlightsOn, NumOn);
+}
+
+void UVehicleEffectsSubsystem::ApplyEffects()
+{
+    static const FName IntensityName(TEXT("Intensity"));
+    static const FName DirectionName(TEXT("Direction"));
+    static const FName TimelineValueName(TEXT("TimelineValue"));
+    static const FName BlinkValueName(TEXT("BlinkValue"));
+
+    ASkidMarkManager* SkidMarkManager = CVarVehicleSkidMarks.GetValueOnGameThread() ? SkidMarks.Get() : nullptr;
+    NumSkidSegments = 0;
+
+    for (const int32 Index : DueIndices)
+    {
+        AVehicleBase* Vehicle = Vehicles[Index];
+        const EVehicleEffectFlags Flags = State.Flags[Index];
+        const EVehicleEffectFlags Changed = (Flags ^ State.AppliedFlags[Index]) & EVehicleEffectFlags::Outputs;
+        const bool bLightsChanged = EnumHasAnyFlags(Flags ^ State.AppliedFlags[Index], EVehicleEffectFlags::Lights);
+        State.AppliedFlags[Index] = Flags;
+
+        // Every vehicle with its lights on glows; SelectHeadlights decides who gets a real light
+        if (bLightsChanged)
+        {
+            const bool bLightsOn = EnumHasAnyFlags(Flags, EVehicleEffectFlags::Lights);
+            Vehicle->SetHeadlightEmissive(bLightsOn);
+            if (bLightsOn)
+            {
+                TimeUntilHeadlightSelection = 0.0f;
+            }
+            else
+            {
+                Headlights.Release(Index);
+            }
+        }
+
+        // Virtual engines get nothing; playing ones only what changed audibly
+        EngineVoices.PushParameters(Index, State.EngineRPM[Index], FMath::Abs(State.Throttle[Index]), State.Speed[Index]);
+        if (State.Tuning[Index].EngineSoundCurve.IsSet())
+        {
+            EngineVoices.PushModulation(Index, State.EngineSoundModulation[Index]);
+        }
+
+        if (UNiagaraComponent* Exhaust = Vehicle->ExhaustVFX)
+        {
+            const bool bOn = EnumHasAnyFlags(Flags, EVehicleEffectFlags::Exhaust);
+            if (EnumHasAnyFlags(Changed, EVehicleEffectFlags::Exhaust))
+            {
+                if (bOn)
+                {
+                    Exhaust->Activate();
+                }
+                else
+                {
+                    Exhaust->Deactivate();
+                }
+            }
+            if (bOn)
+            {
+                Exhaust->SetFloatParameter(IntensityName, State.ExhaustIntensity[Index]);
+                if (State.Tuning[Index].ExhaustVFXCurve.IsSet())
+                {
+                    Exhaust->SetFloatParameter(TimelineValueName, State.ExhaustVFXModulation[Index]);
+                }
+            }
+        }
+
+        if (Vehicle->TireSmokeVFX && EnumHasAnyFlags(Changed, EVehicleEffectFlags::TireSmoke))
+        {
+            if (EnumHasAnyFlags(Flags, EVehicleEffectFlags::TireSmoke))
+            {
+                Vehicle->TireSmokeVFX->Activate();
+                Vehicle->PlayTireScreechSound();
+            }
+            else
+            {
+                Vehicle->TireSmokeVFX->Deactivate();
+                Vehicle->StopTireScreechSound();
+            }
+        }
+
+        // Tire smoke is the slide detection; only vehicles near the camera leave marks
+        if (SkidMarkManager && EnumHasAnyFlags(Flags, EVehicleEffectFlags::TireSmoke) && State.Significance[Index] == EVehicleSignificance::High)
+        {
+            LaySkidMarks(Index, SkidMarkManager);
+        }
+        else
+        {
+            SkidTrails[Index].Reset();
+        }
+
+        if (UNiagaraComponent* BrakeLight = Vehicle->BrakeLightVFX)
+        {
+            const bool bOn = EnumHasAnyFlags(Flags, EVehicleEffectFlags::BrakeLight);
+            if (EnumHasAnyFlags(Changed, EVehicleEffectFlags::BrakeLight))
+            {
+                if (bOn)
+                {
+                    BrakeLight->Activate();
+                }
+                else
+                {
+                    BrakeLight->Deactivate();
+                }
+            }
+            if (bOn)
+            {
+                BrakeLight->SetFloatParameter(IntensityName, State.BrakeLightIntensity[Index]);
+            }
+        }
+
+        // Switching a signal off deactivates the VFX in AVehicleBase itself
+        if (UNiagaraComponent* TurnSignal = Vehicle->TurnSignalVFX)
+        {
+            if (EnumHasAnyFlags(Flags, EVehicleEffectFlags::TurnSignal))
+            {
+                if (EnumHasAnyFlags(Changed, EVehicleEffectFlags::TurnSignal))
+                {
+                    TurnSignal->Activate();
+                }
+                TurnSignal->SetFloatParameter(DirectionName, EnumHasAnyFlags(Flags, EVehicleEffectFlags::LeftSignal) ? -1.0f : 1.0f);
+                TurnSignal->SetFloatParameter(BlinkValueName, State.TurnSignalBlink[Index]);
+            }
+        }
+    }
+
+    // One instance update for every mark laid this frame, however many vehicles are sliding
+    if (SkidMarkManager)
+    {
+        SkidMarkManager->FlushMarks();
+    }
+}
+
+void UVehicleEffectsSubsystem::LaySkidMarks(int32 Index, ASkidMarkManager* Manager)
+{
+    const UChaosWheeledVehicleMovementComponent* Movement = Cast<UChaosWheeledVehicleMovementComponent>(Vehicles[Index]->CachedMovement);
+    if (!Movement) return;
+
+    FSkidMarkTrail& Trail = SkidTrails[Index];
+    Trail.LastPoint.SetNum(Movement->GetNumWheels());
+    const FVector Up = Vehicles[Index]->GetActorUpVector();
+    const float MinLengthSq = FMath::Square(Manager->MinSegmentLength);
+    const float MaxLengthSq = FMath::Square(Manager->MaxSegmentLength);
+
+    for (int32 Wheel = 0; Wheel < Trail.LastPoint.Num(); ++Wheel)
+    {
+        const FWheelStatus& Status = Movement->GetWheelState(Wheel);
+        TOptional<FVector>& LastPoint = Trail.LastPoint[Wheel];
+        if (!Status.bInContact)
+        {
+            LastPoint.Reset();
+            continue;
+        }
+
+        const FVector Point = Status.ContactPoint;
+        if (LastPoint.IsSet())
+        {
+            const float LengthSq = FVector::DistSquared(LastPoint.GetValue(), Point);
+            if (LengthSq < MinLengthSq) continue;
+
+            if (LengthSq <= MaxLengthSq)
+            {
+                Manager->AddSegment(LastPoint.GetValue(), Point, Up);
+                ++NumSkidSegments;
+            }
+        }
+        LastPoint = Point;
+    }
+}
+
+// The real per-actor comparison spawns vehicles in a test world: BeLive.Vehicles.EffectsCost
+static FAutoConsoleCommand VehicleEffectsBenchmarkCommand(
+    TEXT("Vehicle.Effects.Benchmark"),
+    TEXT("Times the vehicle effects math for synthetic vehicles, single-threaded vs ParallelFor. Usage: Vehicle.Effects.Benchmark [Vehicles=1000] [Frames=600]"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        const int32 NumVehicles = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+        const int32 NumFrames = Args.Num() > 1 ? FMath::Max(FCString::Atoi(*Args[1]), 1) : 600;
+
+        FVehicleEffectsState State;
+        TArray<int32> Indices;
+        for (int32 Index = 0; Index < NumVehicles; ++Index)
+        {
+            Indices.Add(State.Add(FVehicleEffectsTuning()));
+        }
+
+        auto RunFrames = [&State, &Indices, NumVehicles, NumFrames](bool bParallel)
+        {
+            FRandomStream Stream(NumVehicles);
+            uint64 Cycles = 0;
+            for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+            {
+                for (int32 Index = 0; Index < NumVehicles; ++Index)
+                {
+                    State.DeltaTime[Index] = 1.0f / 60.0f;
+                    State.Throttle[Index] = Stream.FRandRange(-1.0f, 1.0f);
+                    State.Brake[Index] = Stream.FRand();
+                    State.Speed[Index] = Stream.FRandRange(0.0f, 3000.0f);
+                }
+
+                const uint64 Start = FPlatformTime::Cycles64();
+                FVehicleEffectsState::Compute(State, Indices, Frame / 60.0, bParallel);
+                Cycles += FPlatformTime::Cycles64() - Start;
+            }
+            return FPlatformTime::ToMilliseconds64(Cycles) / NumFrames;
+        };
+
+        const double SerialMs = RunFrames(false);
+        const double ParallelMs = RunFrames(true);
+        UE_LOG(LogTemp, Log, TEXT("Vehicle effects compute, %d vehicles: %.4f ms/frame single-threaded, %.4f ms/frame parallel"), NumVehicles, SerialMs, ParallelMs);
+    }));
@@ -0,0 +1,144 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Vehicles/VehicleSignificanceSubsystem.h"
+#include "Vehicles/VehicleEngineAudioManager.h"
+#include "Vehicles/VehicleHeadlightBudget.h"
+#include "Vehicles/SkidMarkManager.h"
+#include "VehicleEffectsSubsystem.generated.h"
+
+class AVehicleBase;
+struct FRichCurve;
+
+// Inputs copied from the vehicle and the effects they turn on
+enum class EVehicleEffectFlags : uint8
+{
+    None = 0,
+    Handbrake = 1 << 0,
+    LeftSignal = 1 << 1,
+    RightSignal = 1 << 2,
+    Lights = 1 << 3,
+    Exhaust = 1 << 4,
+    TireSmoke = 1 << 5,
+    BrakeLight = 1 << 6,
+    TurnSignal = 1 << 7,
+
+    Inputs = Handbrake | LeftSignal | RightSignal | Lights,
+    Outputs = Exhaust | TireSmoke | BrakeLight | TurnSignal
+};
+ENUM_CLASS_FLAGS(EVehicleEffectFlags);
+
+// A float curve looped over its own key range, sampled analytically from world time
+struct FVehicleLoopingCurve
+{
+    const FRichCurve* Curve = nullptr;
+    float StartTime = 0.0f;
+    float Period = 0.0f;
+
+    void Set(const FRichCurve* InCurve);
+    float Sample(double Time) const;
+    bool IsSet() const { return Curve != nullptr; }
+};
+
+// Per-vehicle tuning, copied from the actor when it registers
+struct FVehicleEffectsTuning
+{
+    float EngineIdleRPM = 800.0f;
+    float MaxEngineRPM = 6000.0f;
+    float ExhaustVFXIntensity = 1.0f;
+    float TireSmokeThreshold = 0.7f;
+    float BrakeLightIntensity = 2.0f;
+    float ReducedUpdateInterval = 0.1f;
+    float TurnSignalBlinkRate = 1.0f;
+    FVehicleLoopingCurve EngineSoundCurve;
+    FVehicleLoopingCurve ExhaustVFXCurve;
+};
+
+// Cosmetic state of every registered vehicle, one contiguous array per field
+struct FVehicleEffectsState
+{
+    TArray<FVehicleEffectsTuning> Tuning;
+    TArray<EVehicleSignificance> Significance;
+    TArray<float> TimeSinceUpdate;
+    TArray<float> DeltaTime;
+    TArray<float> Throttle;
+    TArray<float> Brake;
+    TArray<float> Speed;
+    TArray<float> LastSpeed;
+    TArray<float> EngineRPM;
+    TArray<float> ExhaustIntensity;
+    TArray<float> BrakeLightIntensity;
+    TArray<float> PhaseOffset; // Keeps vehicles sharing a curve out of lockstep
+    TArray<double> TurnSignalOnTime;
+    TArray<float> EngineSoundModulation;
+    TArray<float> ExhaustVFXModulation;
+    TArray<float> TurnSignalBlink;
+    TArray<EVehicleEffectFlags> Flags;
+    TArray<EVehicleEffectFlags> AppliedFlags; // Output bits as last written to the components
+
+    int32 Num() const { return Flags.Num(); }
+    int32 Add(const FVehicleEffectsTuning& InTuning);
+    void RemoveAtSwap(int32 Index);
+
+    // Pure math for the listed vehicles: RPM, exhaust, tire smoke and brake light targets, plus
+    // the curve modulation and blinker phase at Time. Touches no UObjects, so it is safe to
+    // spread across worker threads.
+    static void Compute(FVehicleEffectsState& State, TConstArrayView<int32> Indices, double Time, bool bParallel);
+};
+
+// Updates the cosmetic effects of every vehicle in one pass per frame instead of one actor tick
+// each: gather inputs on the game thread, compute in parallel, then write only the component
+// parameters that are due back on the game thread. Also the shared oscillator for engine and
+// exhaust curve modulation and turn signal blinking, in place of per-vehicle timelines, and
+// owner of the engine voice and headlight budgets.
+UCLASS()
+class BELIVE_API UVehicleEffectsSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Keeps each vehicle's EffectsHandle pointing at its slot as vehicles come and go
+    void RegisterVehicle(AVehicleBase* Vehicle);
+    void UnregisterVehicle(AVehicleBase* Vehicle);
+
+    void SetSignificance(AVehicleBase* Vehicle, EVehicleSignificance Significance);
+
+    // Back to idle RPM with nothing lit or playing, e.g. when the vehicle returns to its pool
+    void ResetVehicle(AVehicleBase* Vehicle);
+
+    float GetEngineRPM(const AVehicleBase* Vehicle) const;
+    EVehicleEffectFlags GetEffectFlags(const AVehicleBase* Vehicle) const;
+
+    void RegisterSkidMarkManager(ASkidMarkManager* Manager);
+    void UnregisterSkidMarkManager(ASkidMarkManager* Manager);
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    // Parallel to State
+    UPROPERTY()
+    TArray<TObjectPtr<AVehicleBase>> Vehicles;
+
+    FVehicleEffectsState State;
+    TArray<int32> DueIndices;
+
+    // Parallel to State
+    FVehicleEngineAudioManager EngineVoices;
+    float TimeUntilVoiceSelection = 0.0f;
+
+    // Parallel to State
+    FVehicleHeadlightBudget Headlights;
+    float TimeUntilHeadlightSelection = 0.0f;
+
+    // Parallel to State
+    TArray<FSkidMarkTrail> SkidTrails;
+    TWeakObjectPtr<ASkidMarkManager> SkidMarks;
+    int32 NumSkidSegments = 0;
+
+    void GatherInputs(float DeltaTime);
+    void SelectEngineVoices();
+    void SelectHeadlights();
+    void ApplyEffects();
+    void LaySkidMarks(int32 Index, ASkidMarkManager* Manager);
+};
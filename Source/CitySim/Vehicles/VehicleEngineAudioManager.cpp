@@ -0,0 +1,172 @@
+#include "Vehicles/VehicleEngineAudioManager.h"
+#include "Components/AudioComponent.h"
+
+// Smallest changes worth sending: about 1% engine pitch at idle, 2% pedal, 1 km/h
+static constexpr float RPMQuantum = 10.0f;
+static constexpr float ThrottleQuantum = 0.02f;
+static constexpr float SpeedQuantum = 28.0f;
+static constexpr float ModulationQuantum = 0.02f;
+
+// Engines below this are silent in the mix and never take a voice
+static constexpr float MinAudibility = 0.002f;
+
+int32 FVehicleEngineAudioManager::Add(UAudioComponent* Component)
+{
+    Audibility.Add(0.0f);
+    bPlaying.Add(false);
+    SentRPM.Add(INT32_MIN);
+    SentThrottle.Add(INT32_MIN);
+    SentSpeed.Add(INT32_MIN);
+    SentModulation.Add(INT32_MIN);
+    return Components.Add(Component);
+}
+
+void FVehicleEngineAudioManager::RemoveAtSwap(int32 Index)
+{
+    if (bPlaying[Index])
+    {
+        Stop(Index);
+    }
+
+    Components.RemoveAtSwap(Index);
+    Audibility.RemoveAtSwap(Index);
+    bPlaying.RemoveAtSwap(Index);
+    SentRPM.RemoveAtSwap(Index);
+    SentThrottle.RemoveAtSwap(Index);
+    SentSpeed.RemoveAtSwap(Index);
+    SentModulation.RemoveAtSwap(Index);
+}
+
+void FVehicleEngineAudioManager::SetAudibility(int32 Index, float InAudibility)
+{
+    Audibility[Index] = InAudibility;
+}
+
+void FVehicleEngineAudioManager::SelectVoices(bool bCanPlay)
+{
+    Candidates.Reset();
+    if (bCanPlay)
+    {
+        for (int32 Index = 0; Index < Components.Num(); ++Index)
+        {
+            if (Audibility[Index] >= MinAudibility && Components[Index].IsValid())
+            {
+                Candidates.Add(Index);
+            }
+        }
+    }
+
+    if (Candidates.Num() > MaxVoices)
+    {
+        Candidates.Sort([this](int32 A, int32 B)
+        {
+            return Audibility[A] * (bPlaying[A] ? PlayingBias : 1.0f) > Audibility[B] * (bPlaying[B] ? PlayingBias : 1.0f);
+        });
+        Candidates.SetNum(FMath::Max(MaxVoices, 0), false);
+    }
+
+    Selected.Init(false, Components.Num());
+    for (const int32 Index : Candidates)
+    {
+        Selected[Index] = true;
+    }
+
+    // Stop the losers before starting the winners so the cap is never exceeded
+    for (int32 Index = 0; Index < Components.Num(); ++Index)
+    {
+        if (bPlaying[Index] && !Selected[Index])
+        {
+            Stop(Index);
+        }
+    }
+    for (const int32 Index : Candidates)
+    {
+        if (!bPlaying[Index])
+        {
+            Start(Index);
+        }
+    }
+}
+
+void FVehicleEngineAudioManager::Virtualize(int32 Index)
+{
+    if (bPlaying[Index])
+    {
+        Stop(Index);
+    }
+    Audibility[Index] = 0.0f;
+}
+
+void FVehicleEngineAudioManager::PushParameters(int32 Index, float RPM, float Throttle, float Speed)
+{
+    if (!bPlaying[Index]) return;
+
+    static const FName RPMName(TEXT("RPM"));
+    static const FName ThrottleName(TEXT("Throttle"));
+    static const FName SpeedName(TEXT("Speed"));
+
+    UAudioComponent* Component = Components[Index].Get();
+    if (!Component) return;
+
+    SendIfChanged(Component, RPMName, RPM, RPMQuantum, SentRPM[Index]);
+    SendIfChanged(Component, ThrottleName, Throttle, ThrottleQuantum, SentThrottle[Index]);
+    SendIfChanged(Component, SpeedName, Speed, SpeedQuantum, SentSpeed[Index]);
+}
+
+void FVehicleEngineAudioManager::PushModulation(int32 Index, float Modulation)
+{
+    if (!bPlaying[Index]) return;
+
+    static const FName TimelineValueName(TEXT("TimelineValue"));
+    if (UAudioComponent* Component = Components[Index].Get())
+    {
+        SendIfChanged(Component, TimelineValueName, Modulation, ModulationQuantum, SentModulation[Index]);
+    }
+}
+
+float FVehicleEngineAudioManager::GetLoudness(float NormalizedRPM, float Throttle)
+{
+    // An idling engine is still clearly audible; load adds the rest
+    return 0.3f + 0.4f * FMath::Clamp(NormalizedRPM, 0.0f, 1.0f) + 0.3f * FMath::Clamp(FMath::Abs(Throttle), 0.0f, 1.0f);
+}
+
+int32 FVehicleEngineAudioManager::ConsumeParameterSends()
+{
+    const int32 Sends = ParameterSends;
+    ParameterSends = 0;
+    return Sends;
+}
+
+void FVehicleEngineAudioManager::Start(int32 Index)
+{
+    // Playing voices start from scratch, so everything goes out on the next push
+    SentRPM[Index] = INT32_MIN;
+    SentThrottle[Index] = INT32_MIN;
+    SentSpeed[Index] = INT32_MIN;
+    SentModulation[Index] = INT32_MIN;
+
+    Components[Index]->Play();
+    bPlaying[Index] = true;
+    ++ActiveCount;
+}
+
+void FVehicleEngineAudioManager::Stop(int32 Index)
+{
+    if (UAudioComponent* Component = Components[Index].Get())
+    {
+        Component->Stop();
+    }
+    bPlaying[Index] = false;
+    --ActiveCount;
+}
+
+bool FVehicleEngineAudioManager::SendIfChanged(UAudioComponent* Component, const FName& Name, float Value, float Quantum, int32& Sent)
+{
+    const int32 Quantized = FMath::RoundToInt32(Value / Quantum);
+    if (Quantized == Sent) return false;
+
+    Sent = Quantized;
+    Component->SetFloatParameter(Name, Quantized * Quantum);
+    ++ParameterSends;
+    return true;
+}
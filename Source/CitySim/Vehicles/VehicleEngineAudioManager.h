@@ -0,0 +1,67 @@
+#pragma once
+#include "CoreMinimal.h"
+
+class UAudioComponent;
+
+// Hard cap on concurrently playing vehicle engine loops. Each selection pass the most audible
+// engines (loudness over distance) get the voices; the rest are virtualized, i.e. stopped and
+// sent no parameters until they win a voice back. Playing engines only get a parameter when
+// its quantized value changes, so steady cruising sends nothing.
+//
+// Slots are parallel to FVehicleEffectsState and are added and swap-removed in step with it.
+class BELIVE_API FVehicleEngineAudioManager
+{
+public:
+    int32 MaxVoices = 16;
+
+    // Distance (cm) at which an engine is half as audible as it is up close
+    float ReferenceDistance = 1500.0f;
+
+    // Playing engines count this much more audible when competing, so the cap doesn't flip-flop
+    float PlayingBias = 1.25f;
+
+    int32 Add(UAudioComponent* Component);
+    void RemoveAtSwap(int32 Index);
+
+    // 0 takes the engine out of the running; set for every slot before SelectVoices
+    void SetAudibility(int32 Index, float Audibility);
+
+    // Starts the winners and stops the rest. bCanPlay false virtualizes every engine.
+    void SelectVoices(bool bCanPlay);
+
+    // Stops one engine straight away, e.g. when its vehicle drops to low significance
+    void Virtualize(int32 Index);
+
+    // Sends whatever changed perceptibly; nothing for virtual engines
+    void PushParameters(int32 Index, float RPM, float Throttle, float Speed);
+    void PushModulation(int32 Index, float Modulation);
+
+    // Engine loudness relative to full throttle at max RPM, from 0..1 RPM and throttle
+    static float GetLoudness(float NormalizedRPM, float Throttle);
+
+    int32 GetActiveVoiceCount() const { return ActiveCount; }
+    int32 GetVirtualVoiceCount() const { return Components.Num() - ActiveCount; }
+
+    // Parameter sends since the last call
+    int32 ConsumeParameterSends();
+
+private:
+    TArray<TWeakObjectPtr<UAudioComponent>> Components;
+    TArray<float> Audibility;
+    TArray<bool> bPlaying;
+
+    // Last sent values in quanta; INT32_MIN forces the next send
+    TArray<int32> SentRPM;
+    TArray<int32> SentThrottle;
+    TArray<int32> SentSpeed;
+    TArray<int32> SentModulation;
+
+    TArray<int32> Candidates;
+    TArray<bool> Selected;
+    int32 ActiveCount = 0;
+    int32 ParameterSends = 0;
+
+    void Start(int32 Index);
+    void Stop(int32 Index);
+    bool SendIfChanged(UAudioComponent* Component, const FName& Name, float Value, float Quantum, int32& Sent);
+};
@@ -0,0 +1,147 @@
+#include "Vehicles/VehicleFrictionSubsystem.h"
+#include "Vehicles/VehicleBase.h"
+#include "World/WeatherSubsystem.h"
+#include "World/WeatherManager.h"
+#include "ChaosWheeledVehicleMovementComponent.h"
+#include "ChaosVehicleWheel.h"
+#include "PhysicalMaterials/PhysicalMaterial.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Road Grip Push"), STAT_VehicleFrictionPush, STATGROUP_Vehicles);
+DECLARE_CYCLE_STAT(TEXT("Road Grip Surface Check"), STAT_VehicleFrictionSurfaceCheck, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Road Grip Wheel Sends"), STAT_VehicleFrictionWheelSends, STATGROUP_Vehicles);
+
+static TAutoConsoleVariable<float> CVarVehicleFrictionSurfaceInterval(
+    TEXT("Vehicle.Friction.SurfaceInterval"), 0.5f,
+    TEXT("Seconds between checks of which surface awake vehicles' wheels are on; 0 only applies grip on weather changes."));
+
+// Marks a wheel whose multiplier hasn't been sent yet
+static constexpr uint8 SurfaceNotSent = 0xFF;
+
+void UVehicleFrictionSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    if (UWeatherSubsystem* WeatherSubsystem = Collection.InitializeDependency<UWeatherSubsystem>())
+    {
+        WeatherTypeChangedHandle = WeatherSubsystem->OnWeatherTypeChanged.AddUObject(this, &UVehicleFrictionSubsystem::OnWeatherTypeChanged);
+    }
+}
+
+void UVehicleFrictionSubsystem::Deinitialize()
+{
+    if (UWeatherSubsystem* WeatherSubsystem = GetWorld()->GetSubsystem<UWeatherSubsystem>())
+    {
+        WeatherSubsystem->OnWeatherTypeChanged.Remove(WeatherTypeChangedHandle);
+    }
+
+    Super::Deinitialize();
+}
+
+void UVehicleFrictionSubsystem::RegisterVehicle(AVehicleBase* Vehicle)
+{
+    if (Vehicles.Contains(Vehicle)) return;
+
+    Vehicles.Add(Vehicle);
+    WheelSurfaces.AddDefaulted();
+    if (CurrentRow.Num() > 0)
+    {
+        ApplyToVehicle(Vehicles.Num() - 1, true);
+    }
+}
+
+void UVehicleFrictionSubsystem::UnregisterVehicle(AVehicleBase* Vehicle)
+{
+    const int32 Index = Vehicles.IndexOfByKey(Vehicle);
+    if (Index == INDEX_NONE) return;
+
+    Vehicles.RemoveAtSwap(Index);
+    WheelSurfaces.RemoveAtSwap(Index);
+}
+
+float UVehicleFrictionSubsystem::GetCurrentMultiplier(EPhysicalSurface Surface) const
+{
+    return CurrentRow.IsValidIndex(Surface) ? CurrentRow[Surface] : 1.0f;
+}
+
+void UVehicleFrictionSubsystem::Tick(float DeltaTime)
+{
+    const float Interval = CVarVehicleFrictionSurfaceInterval.GetValueOnGameThread();
+    if (CurrentRow.Num() == 0 || Interval <= 0.0f) return;
+
+    TimeUntilSurfaceCheck -= DeltaTime;
+    if (TimeUntilSurfaceCheck > 0.0f) return;
+    TimeUntilSurfaceCheck = Interval;
+
+    SCOPE_CYCLE_COUNTER(STAT_VehicleFrictionSurfaceCheck);
+
+    // Sleeping vehicles aren't rolling anywhere new; the weather push keeps them current
+    int32 NumSent = 0;
+    for (int32 Index = 0; Index < Vehicles.Num(); ++Index)
+    {
+        const AVehicleBase* Vehicle = Vehicles[Index].Get();
+        if (Vehicle && !Vehicle->IsSleeping())
+        {
+            NumSent += ApplyToVehicle(Index, false);
+        }
+    }
+    INC_DWORD_STAT_BY(STAT_VehicleFrictionWheelSends, NumSent);
+}
+
+TStatId UVehicleFrictionSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UVehicleFrictionSubsystem, STATGROUP_Tickables);
+}
+
+void UVehicleFrictionSubsystem::OnWeatherTypeChanged(EWeatherType Weather)
+{
+    const UWeatherSubsystem* WeatherSubsystem = GetWorld()->GetSubsystem<UWeatherSubsystem>();
+    const AWeatherManager* Manager = WeatherSubsystem ? WeatherSubsystem->GetWeatherManager() : nullptr;
+    if (!Manager || !Manager->GetFrictionTable().IsBaked()) return;
+
+    SCOPE_CYCLE_COUNTER(STAT_VehicleFrictionPush);
+
+    const TConstArrayView<float> Row = Manager->GetFrictionTable().GetRow(Weather);
+    CurrentRow.Reset();
+    CurrentRow.Append(Row.GetData(), Row.Num());
+
+    // Every vehicle, asleep or not, so nobody wakes up with the last weather's grip
+    int32 NumSent = 0;
+    for (int32 Index = 0; Index < Vehicles.Num(); ++Index)
+    {
+        NumSent += ApplyToVehicle(Index, true);
+    }
+    INC_DWORD_STAT_BY(STAT_VehicleFrictionWheelSends, NumSent);
+}
+
+int32 UVehicleFrictionSubsystem::ApplyToVehicle(int32 Index, bool bForce)
+{
+    const AVehicleBase* Vehicle = Vehicles[Index].Get();
+    UChaosWheeledVehicleMovementComponent* Movement = Vehicle ? Cast<UChaosWheeledVehicleMovementComponent>(Vehicle->GetVehicleMovementComponent()) : nullptr;
+    if (!Movement) return 0;
+
+    TArray<uint8, TInlineAllocator<4>>& Surfaces = WheelSurfaces[Index];
+    Surfaces.SetNum(Movement->GetNumWheels());
+
+    int32 NumSent = 0;
+    for (int32 Wheel = 0; Wheel < Surfaces.Num(); ++Wheel)
+    {
+        // Airborne wheels keep the surface they last touched
+        const FWheelStatus& Status = Movement->GetWheelState(Wheel);
+        uint8 Surface = Surfaces[Wheel];
+        if (Status.bInContact || Surface == SurfaceNotSent)
+        {
+            Surface = static_cast<uint8>(UPhysicalMaterial::DetermineSurfaceType(Status.PhysMaterial.Get()));
+        }
+        if (!bForce && Surface == Surfaces[Wheel]) continue;
+
+        // Scales the wheel's authored friction rather than replacing it
+        const UChaosVehicleWheel* WheelSetup = Movement->Wheels.IsValidIndex(Wheel) ? Movement->Wheels[Wheel].Get() : nullptr;
+        const float BaseFriction = WheelSetup ? WheelSetup->FrictionForceMultiplier : 1.0f;
+        Movement->SetWheelFrictionMultiplier(Wheel, BaseFriction * CurrentRow[Surface]);
+
+        Surfaces[Wheel] = Surface;
+        ++NumSent;
+    }
+    return NumSent;
+}
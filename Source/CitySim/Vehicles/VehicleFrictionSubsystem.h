@@ -0,0 +1,49 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "World/WeatherTypes.h"
+#include "VehicleFrictionSubsystem.generated.h"
+
+class AVehicleBase;
+
+// Applies weather-dependent road grip to the wheels of every registered vehicle. The
+// multipliers per (surface, weather) are baked by AWeatherManager; when the weather settles on a
+// new type, its row is pushed to every vehicle in one pass. In between, awake vehicles have
+// their wheels' contact surfaces re-checked a few times a second, and only wheels that have
+// moved onto a different surface are sent again.
+UCLASS()
+class BELIVE_API UVehicleFrictionSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    void RegisterVehicle(AVehicleBase* Vehicle);
+    void UnregisterVehicle(AVehicleBase* Vehicle);
+
+    // Multiplier currently applied to wheels on Surface; 1 before the weather manager has reported in
+    float GetCurrentMultiplier(EPhysicalSurface Surface) const;
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    TArray<TWeakObjectPtr<AVehicleBase>> Vehicles;
+
+    // Parallel to Vehicles: surface each wheel's multiplier was last sent for, SurfaceNotSent if never
+    TArray<TArray<uint8, TInlineAllocator<4>>> WheelSurfaces;
+
+    // Row of the baked table for the current weather, indexed by EPhysicalSurface
+    TArray<float> CurrentRow;
+
+    FDelegateHandle WeatherTypeChangedHandle;
+    float TimeUntilSurfaceCheck = 0.0f;
+
+    void OnWeatherTypeChanged(EWeatherType Weather);
+
+    // Sends each wheel of the vehicle whose surface differs from the last one sent, or every
+    // wheel with bForce; returns the number of wheels sent
+    int32 ApplyToVehicle(int32 Index, bool bForce);
+};
@@ -0,0 +1,226 @@
+#include "Vehicles/VehicleHeadlightBudget.h"
+#include "Components/SpotLightComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+// Aimed slightly down at the road ahead
+static const FRotator HeadlightRotation(-5.0f, 0.0f, 0.0f);
+
+int32 FVehicleHeadlightBudget::Add(const FVehicleHeadlightMount& InMount)
+{
+    Score.Add(0.0f);
+    SlotLight.Add(INDEX_NONE);
+    return Mounts.Add(InMount);
+}
+
+void FVehicleHeadlightBudget::RemoveAtSwap(int32 Index)
+{
+    // The vehicle is going away; its light goes dark at once rather than fading on a dead mount
+    for (int32 Light = 0; Light < Lights.Num(); ++Light)
+    {
+        if (LightTarget[Light] == Index)
+        {
+            LightTarget[Light] = INDEX_NONE;
+        }
+        if (LightOwner[Light] == Index)
+        {
+            LightOwner[Light] = INDEX_NONE;
+            LightFade[Light] = 0.0f;
+            Mount(Light);
+        }
+    }
+
+    // Whoever was last moves into Index
+    const int32 Last = Mounts.Num() - 1;
+    for (int32 Light = 0; Light < Lights.Num(); ++Light)
+    {
+        if (LightTarget[Light] == Last)
+        {
+            LightTarget[Light] = Index;
+        }
+        if (LightOwner[Light] == Last)
+        {
+            LightOwner[Light] = Index;
+        }
+    }
+
+    Mounts.RemoveAtSwap(Index);
+    Score.RemoveAtSwap(Index);
+    SlotLight.RemoveAtSwap(Index);
+}
+
+void FVehicleHeadlightBudget::SetScore(int32 Index, float InScore)
+{
+    Score[Index] = InScore;
+}
+
+void FVehicleHeadlightBudget::SelectLights(UWorld* World)
+{
+    const int32 Budget = FMath::Max(MaxLights, 0);
+    if (World && Lights.Num() < Budget)
+    {
+        CreateLights(World);
+    }
+
+    Candidates.Reset();
+    for (int32 Index = 0; Index < Mounts.Num(); ++Index)
+    {
+        if (Score[Index] > 0.0f && Mounts[Index].Parent.IsValid())
+        {
+            Candidates.Add(Index);
+        }
+    }
+
+    const int32 NumLights = FMath::Min(Budget, Lights.Num());
+    if (Candidates.Num() > NumLights)
+    {
+        Candidates.Sort([this](int32 A, int32 B)
+        {
+            return Score[A] * (SlotLight[A] != INDEX_NONE ? HeldBias : 1.0f) > Score[B] * (SlotLight[B] != INDEX_NONE ? HeldBias : 1.0f);
+        });
+        Candidates.SetNum(NumLights, false);
+    }
+
+    Selected.Init(false, Mounts.Num());
+    for (const int32 Index : Candidates)
+    {
+        Selected[Index] = true;
+    }
+
+    // Losers, and lights beyond a budget that has shrunk, head for nobody
+    for (int32 Light = 0; Light < Lights.Num(); ++Light)
+    {
+        const int32 Target = LightTarget[Light];
+        if (Target != INDEX_NONE && (!Selected[Target] || Light >= NumLights))
+        {
+            SlotLight[Target] = INDEX_NONE;
+            LightTarget[Light] = INDEX_NONE;
+        }
+    }
+
+    // Winners without one take a free light
+    int32 FreeLight = 0;
+    for (const int32 Index : Candidates)
+    {
+        if (SlotLight[Index] != INDEX_NONE) continue;
+
+        while (FreeLight < NumLights && LightTarget[FreeLight] != INDEX_NONE)
+        {
+            ++FreeLight;
+        }
+        if (FreeLight == NumLights) break;
+
+        LightTarget[FreeLight] = Index;
+        SlotLight[Index] = FreeLight;
+    }
+}
+
+void FVehicleHeadlightBudget::Release(int32 Index)
+{
+    const int32 Light = SlotLight[Index];
+    if (Light == INDEX_NONE) return;
+
+    LightTarget[Light] = INDEX_NONE;
+    SlotLight[Index] = INDEX_NONE;
+}
+
+void FVehicleHeadlightBudget::Update(float DeltaTime)
+{
+    const float Step = FadeTime > KINDA_SMALL_NUMBER ? DeltaTime / FadeTime : 1.0f;
+    for (int32 Light = 0; Light < Lights.Num(); ++Light)
+    {
+        USpotLightComponent* Component = Lights[Light].Get();
+        if (!Component) continue;
+
+        // A light only changes vehicles once it has faded out completely
+        float Fade = LightFade[Light];
+        if (LightOwner[Light] != LightTarget[Light])
+        {
+            Fade = FMath::Max(Fade - Step, 0.0f);
+            if (Fade <= 0.0f)
+            {
+                LightOwner[Light] = LightTarget[Light];
+                LightFade[Light] = 0.0f;
+                Mount(Light);
+                continue;
+            }
+        }
+        else if (LightOwner[Light] != INDEX_NONE)
+        {
+            Fade = FMath::Min(Fade + Step, 1.0f);
+        }
+
+        if (Fade != LightFade[Light] && LightOwner[Light] != INDEX_NONE)
+        {
+            LightFade[Light] = Fade;
+            Component->SetIntensity(Mounts[LightOwner[Light]].Intensity * Fade);
+        }
+    }
+}
+
+int32 FVehicleHeadlightBudget::GetNumAssigned() const
+{
+    int32 NumAssigned = 0;
+    for (const int32 Owner : LightOwner)
+    {
+        NumAssigned += Owner != INDEX_NONE ? 1 : 0;
+    }
+    return NumAssigned;
+}
+
+void FVehicleHeadlightBudget::CreateLights(UWorld* World)
+{
+    AActor* Holder = LightHolder.Get();
+    if (!Holder)
+    {
+        FActorSpawnParameters Params;
+        Params.ObjectFlags |= RF_Transient;
+        Holder = World->SpawnActor<AActor>(Params);
+        if (!Holder) return;
+
+        USceneComponent* Root = NewObject<USceneComponent>(Holder, TEXT("Root"));
+        Holder->SetRootComponent(Root);
+        Root->RegisterComponent();
+        LightHolder = Holder;
+    }
+
+    // Owned by the holder, attached to whichever vehicle they are lighting
+    while (Lights.Num() < MaxLights)
+    {
+        USpotLightComponent* Light = NewObject<USpotLightComponent>(Holder);
+        Light->SetMobility(EComponentMobility::Movable);
+        Light->SetCastShadows(false);
+        Light->SetIntensity(0.0f);
+        Light->SetVisibility(false);
+        Light->RegisterComponent();
+
+        Lights.Add(Light);
+        LightOwner.Add(INDEX_NONE);
+        LightTarget.Add(INDEX_NONE);
+        LightFade.Add(0.0f);
+    }
+}
+
+void FVehicleHeadlightBudget::Mount(int32 Light)
+{
+    USpotLightComponent* Component = Lights[Light].Get();
+    if (!Component) return;
+
+    const int32 Owner = LightOwner[Light];
+    USceneComponent* Parent = Owner != INDEX_NONE ? Mounts[Owner].Parent.Get() : nullptr;
+    if (!Parent)
+    {
+        Component->SetVisibility(false);
+        Component->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
+        LightOwner[Light] = INDEX_NONE;
+        return;
+    }
+
+    const FVehicleHeadlightMount& HeadlightMount = Mounts[Owner];
+    Component->AttachToComponent(Parent, FAttachmentTransformRules::KeepRelativeTransform);
+    Component->SetRelativeLocationAndRotation(HeadlightMount.Offset, HeadlightRotation);
+    Component->SetAttenuationRadius(HeadlightMount.AttenuationRadius);
+    Component->SetOuterConeAngle(HeadlightMount.OuterConeAngle);
+    Component->SetIntensity(0.0f);
+    Component->SetVisibility(true);
+}
@@ -0,0 +1,70 @@
+#pragma once
+#include "CoreMinimal.h"
+
+class AActor;
+class USceneComponent;
+class USpotLightComponent;
+
+// Where and how a vehicle's headlight sits when it has one
+struct FVehicleHeadlightMount
+{
+    TWeakObjectPtr<USceneComponent> Parent;
+    FVector Offset = FVector::ZeroVector;
+    float Intensity = 0.0f;
+    float AttenuationRadius = 0.0f;
+    float OuterConeAngle = 0.0f;
+};
+
+// Fixed budget of real spot lights shared by every vehicle. Each selection pass the highest
+// scoring vehicles with their lights on get one; everyone else makes do with emissive materials.
+// Lights fade out of their old vehicle before fading in on the new one, and vehicles already
+// holding a light get a bias when competing, so lights don't pop or flip-flop.
+//
+// Slots are parallel to FVehicleEffectsState and are added and swap-removed in step with it.
+class BELIVE_API FVehicleHeadlightBudget
+{
+public:
+    int32 MaxLights = 8;
+
+    // Vehicles holding a light count this much higher when competing
+    float HeldBias = 1.5f;
+
+    // Seconds for a light to fade fully in or out
+    float FadeTime = 0.3f;
+
+    int32 Add(const FVehicleHeadlightMount& InMount);
+    void RemoveAtSwap(int32 Index);
+
+    // 0 takes the vehicle out of the running; set for every slot before SelectLights
+    void SetScore(int32 Index, float InScore);
+
+    // Picks the winners; lights move to them over the following Update calls. Lights are
+    // created on a transient actor in World as the budget needs them.
+    void SelectLights(UWorld* World);
+
+    // Starts fading out the vehicle's light, e.g. when its lights are switched off
+    void Release(int32 Index);
+
+    // Fades and re-attaches lights; every frame
+    void Update(float DeltaTime);
+
+    int32 GetNumAssigned() const;
+
+private:
+    TArray<FVehicleHeadlightMount> Mounts;
+    TArray<float> Score;
+    TArray<int32> SlotLight; // Light a vehicle has or is about to get
+
+    // Per light: the vehicle it is on, the vehicle it is heading for, and its 0..1 fade
+    TArray<TWeakObjectPtr<USpotLightComponent>> Lights;
+    TArray<int32> LightOwner;
+    TArray<int32> LightTarget;
+    TArray<float> LightFade;
+    TWeakObjectPtr<AActor> LightHolder;
+
+    TArray<int32> Candidates;
+    TArray<bool> Selected;
+
+    void CreateLights(UWorld* World);
+    void Mount(int32 Light);
+};
@@ -0,0 +1,166 @@
+#include "Vehicles/VehicleSignificanceSubsystem.h"
+#include "Vehicles/VehicleBase.h"
+#include "Interaction/NearbyInteractComponent.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "HAL/IConsoleManager.h"
+
+DECLARE_CYCLE_STAT(TEXT("Vehicle Significance Update"), STAT_VehicleSignificanceUpdate, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicles High Significance"), STAT_VehiclesHigh, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicles Medium Significance"), STAT_VehiclesMedium, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicles Low Significance"), STAT_VehiclesLow, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicles Awake"), STAT_VehiclesAwake, STATGROUP_Vehicles);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Vehicles Sleeping"), STAT_VehiclesSleeping, STATGROUP_Vehicles);
+
+static TAutoConsoleVariable<float> CVarVehicleSignificanceHighDistance(
+    TEXT("Vehicle.Significance.HighDistance"), 3000.0f,
+    TEXT("Vehicles within this distance (cm) of the camera and in view get full cosmetic updates."));
+
+static TAutoConsoleVariable<float> CVarVehicleSignificanceMediumDistance(
+    TEXT("Vehicle.Significance.MediumDistance"), 8000.0f,
+    TEXT("Vehicles within this distance (cm) of the camera get reduced-rate cosmetic updates; beyond it cosmetics are off."));
+
+static TAutoConsoleVariable<float> CVarVehicleSignificanceUpdateInterval(
+    TEXT("Vehicle.Significance.UpdateInterval"), 0.25f,
+    TEXT("Seconds between significance re-evaluations."));
+
+static TAutoConsoleVariable<float> CVarVehicleWakeMargin(
+    TEXT("Vehicle.Sleep.WakeMargin"), 200.0f,
+    TEXT("Added to a character's interact radius when waking vehicles, to cover movement between updates."));
+
+// Fraction of a distance band a vehicle must move back past before it is promoted again
+static constexpr float SignificanceHysteresis = 0.1f;
+
+void UVehicleSignificanceSubsystem::RegisterVehicle(AVehicleBase* Vehicle)
+{
+    Vehicles.AddUnique(Vehicle);
+    RequestUpdate();
+}
+
+void UVehicleSignificanceSubsystem::UnregisterVehicle(AVehicleBase* Vehicle)
+{
+    Vehicles.RemoveSwap(Vehicle);
+}
+
+void UVehicleSignificanceSubsystem::RegisterWaker(UNearbyInteractComponent* Waker)
+{
+    Wakers.AddUnique(Waker);
+}
+
+void UVehicleSignificanceSubsystem::UnregisterWaker(UNearbyInteractComponent* Waker)
+{
+    Wakers.RemoveSwap(Waker);
+}
+
+void UVehicleSignificanceSubsystem::Tick(float DeltaTime)
+{
+    TimeUntilUpdate -= DeltaTime;
+    if (TimeUntilUpdate > 0.0f) return;
+
+    TimeUntilUpdate = CVarVehicleSignificanceUpdateInterval.GetValueOnGameThread();
+    UpdateSignificance();
+}
+
+TStatId UVehicleSignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UVehicleSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UVehicleSignificanceSubsystem::UpdateSignificance()
+{
+    SCOPE_CYCLE_COUNTER(STAT_VehicleSignificanceUpdate);
+
+    // Without a local camera (e.g. a dedicated server) there is nobody to show cosmetics to
+    const APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(GetWorld(), 0);
+    const bool bHasView = CameraManager != nullptr;
+    const FVector ViewLocation = bHasView ? CameraManager->GetCameraLocation() : FVector::ZeroVector;
+    const FVector ViewDirection = bHasView ? CameraManager->GetCameraRotation().Vector() : FVector::ForwardVector;
+
+    // Widen the view cone a little so vehicles at the screen edge don't flicker
+    const float HalfFOV = bHasView ? FMath::DegreesToRadians(CameraManager->GetFOVAngle() * 0.5f) : 0.0f;
+    const float ViewConeCos = FMath::Cos(FMath::Min(HalfFOV * 1.2f, PI));
+
+    const float HighDistance = CVarVehicleSignificanceHighDistance.GetValueOnGameThread();
+    const float MediumDistance = FMath::Max(CVarVehicleSignificanceMediumDistance.GetValueOnGameThread(), HighDistance);
+
+    // Wake spheres: character location and squared reach
+    const float WakeMargin = CVarVehicleWakeMargin.GetValueOnGameThread();
+    TArray<TPair<FVector, float>, TInlineAllocator<4>> WakeSpheres;
+    Wakers.RemoveAllSwap([](const TWeakObjectPtr<UNearbyInteractComponent>& Waker) { return !Waker.IsValid(); });
+    for (const TWeakObjectPtr<UNearbyInteractComponent>& Waker : Wakers)
+    {
+        WakeSpheres.Emplace(Waker->GetOwner()->GetActorLocation(), FMath::Square(Waker->Radius + WakeMargin));
+    }
+
+    FMemory::Memzero(BucketCounts);
+    AwakeCount = 0;
+    SleepingCount = 0;
+    Vehicles.RemoveAllSwap([](const TWeakObjectPtr<AVehicleBase>& Vehicle) { return !Vehicle.IsValid(); });
+
+    for (const TWeakObjectPtr<AVehicleBase>& VehiclePtr : Vehicles)
+    {
+        AVehicleBase* Vehicle = VehiclePtr.Get();
+        const FVector VehicleLocation = Vehicle->GetActorLocation();
+
+        const bool bNearWaker = WakeSpheres.ContainsByPredicate([&VehicleLocation](const TPair<FVector, float>& Sphere)
+        {
+            return FVector::DistSquared(Sphere.Key, VehicleLocation) <= Sphere.Value;
+        });
+        if (Vehicle->IsSleeping())
+        {
+            if (bNearWaker)
+            {
+                Vehicle->WakeUp();
+            }
+        }
+        else if (!bNearWaker && Vehicle->CanSleep())
+        {
+            Vehicle->Sleep();
+        }
+        if (Vehicle->IsSleeping())
+        {
+            ++SleepingCount;
+        }
+        else
+        {
+            ++AwakeCount;
+        }
+
+        EVehicleSignificance Significance = EVehicleSignificance::Low;
+
+        if (Vehicle->IsPlayerControlled())
+        {
+            Significance = EVehicleSignificance::High;
+        }
+        else if (bHasView)
+        {
+            const FVector ToVehicle = VehicleLocation - ViewLocation;
+            const float Distance = ToVehicle.Size();
+            const bool bInView = Distance <= KINDA_SMALL_NUMBER || FVector::DotProduct(ToVehicle / Distance, ViewDirection) >= ViewConeCos;
+
+            // Vehicles keep their current bucket until they are clearly inside a better one
+            const EVehicleSignificance Current = Vehicle->GetSignificance();
+            const float HighLimit = HighDistance * (Current == EVehicleSignificance::High ? 1.0f : 1.0f - SignificanceHysteresis);
+            const float MediumLimit = MediumDistance * (Current == EVehicleSignificance::Low ? 1.0f - SignificanceHysteresis : 1.0f);
+
+            if (Distance <= HighLimit && bInView)
+            {
+                Significance = EVehicleSignificance::High;
+            }
+            else if (Distance <= MediumLimit)
+            {
+                // Nearby vehicles behind the camera can still be heard, so they keep reduced-rate cosmetics
+                Significance = EVehicleSignificance::Medium;
+            }
+        }
+
+        Vehicle->SetSignificance(Significance);
+        ++BucketCounts[static_cast<int32>(Significance)];
+    }
+
+    SET_DWORD_STAT(STAT_VehiclesHigh, BucketCounts[static_cast<int32>(EVehicleSignificance::High)]);
+    SET_DWORD_STAT(STAT_VehiclesMedium, BucketCounts[static_cast<int32>(EVehicleSignificance::Medium)]);
+    SET_DWORD_STAT(STAT_VehiclesLow, BucketCounts[static_cast<int32>(EVehicleSignificance::Low)]);
+    SET_DWORD_STAT(STAT_VehiclesAwake, AwakeCount);
+    SET_DWORD_STAT(STAT_VehiclesSleeping, SleepingCount);
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "VehicleSignificanceSubsystem.generated.h"
+
+class AVehicleBase;
+class UNearbyInteractComponent;
+
+// How much cosmetic work a vehicle does, from full fidelity down to none
+UENUM(BlueprintType)
+enum class EVehicleSignificance : uint8
+{
+    High,   // Cosmetics every frame
+    Medium, // Cosmetics at a reduced tick rate
+    Low     // No cosmetic tick; audio and Niagara deactivated
+};
+
+// Buckets registered vehicles by distance to the player camera and whether they are in view,
+// and hands each its significance. Also puts parked vehicles to sleep and wakes them when a
+// character with a UNearbyInteractComponent comes within reach. Re-evaluated a few times a
+// second, not every frame.
+UCLASS()
+class BELIVE_API UVehicleSignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    void RegisterVehicle(AVehicleBase* Vehicle);
+    void UnregisterVehicle(AVehicleBase* Vehicle);
+
+    // Characters whose interact radius wakes sleeping vehicles
+    void RegisterWaker(UNearbyInteractComponent* Waker);
+    void UnregisterWaker(UNearbyInteractComponent* Waker);
+
+    // Re-evaluate on the next tick, e.g. after possession changes
+    void RequestUpdate() { TimeUntilUpdate = 0.0f; }
+
+    int32 GetVehicleCount(EVehicleSignificance Significance) const { return BucketCounts[static_cast<int32>(Significance)]; }
+    int32 GetAwakeVehicleCount() const { return AwakeCount; }
+    int32 GetSleepingVehicleCount() const { return SleepingCount; }
+
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+private:
+    TArray<TWeakObjectPtr<AVehicleBase>> Vehicles;
+    TArray<TWeakObjectPtr<UNearbyInteractComponent>> Wakers;
+    float TimeUntilUpdate = 0.0f;
+    int32 BucketCounts[3] = {};
+    int32 AwakeCount = 0;
+    int32 SleepingCount = 0;
+
+    void UpdateSignificance();
+};
@@ -0,0 +1,144 @@
+#include "Vehicles/VehicleTelemetry.h"
+#include "Vehicles/VehicleBase.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/MemoryReader.h"
+
+FArchive& operator<<(FArchive& Ar, FVehicleTelemetrySample& Sample)
+{
+    uint8 Flags = static_cast<uint8>(Sample.Flags);
+    Ar << Sample.Frame << Sample.Time << Sample.FrameTime << Sample.Throttle << Sample.Steer << Sample.Brake << Sample.EngineRPM << Sample.Speed << Flags;
+    Sample.Flags = static_cast<EVehicleTelemetryFlags>(Flags);
+    return Ar;
+}
+
+void FVehicleTelemetryRing::Init(int32 Capacity)
+{
+    Samples.SetNumZeroed(FMath::Max(Capacity, 1));
+    Reset();
+}
+
+void FVehicleTelemetryRing::Record(const FVehicleTelemetrySample& Sample)
+{
+    Samples[Head] = Sample;
+    Head = (Head + 1) % Samples.Num();
+    Count = FMath::Min(Count + 1, Samples.Num());
+}
+
+void FVehicleTelemetryRing::Reset()
+{
+    Head = 0;
+    Count = 0;
+}
+
+bool FVehicleTelemetryRing::Save(const FString& Path, const FString& VehicleName) const
+{
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+
+    uint32 Magic = FVehicleTelemetryFile::Magic;
+    uint32 Version = FVehicleTelemetryFile::Version;
+    FString Name = VehicleName;
+    uint32 NumSamples = Count;
+    Writer << Magic << Version << Name << NumSamples;
+
+    // Oldest first; before the ring wraps the oldest sample is at 0
+    const int32 First = Count < Samples.Num() ? 0 : Head;
+    for (int32 Offset = 0; Offset < Count; ++Offset)
+    {
+        FVehicleTelemetrySample Sample = Samples[(First + Offset) % Samples.Num()];
+        Writer << Sample;
+    }
+
+    return FFileHelper::SaveArrayToFile(Bytes, *Path);
+}
+
+bool FVehicleTelemetryFile::Load(const FString& Path, FString& OutVehicleName, TArray<FVehicleTelemetrySample>& OutSamples)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *Path)) return false;
+
+    FMemoryReader Reader(Bytes);
+    uint32 FileMagic = 0;
+    uint32 FileVersion = 0;
+    uint32 NumSamples = 0;
+    Reader << FileMagic << FileVersion;
+    if (FileMagic != Magic || FileVersion != Version) return false;
+
+    Reader << OutVehicleName << NumSamples;
+    if (Reader.IsError()) return false;
+
+    // A truncated or corrupt count must not turn into a huge allocation
+    if (NumSamples > (Reader.TotalSize() - Reader.Tell()) / FVehicleTelemetryFile::SampleSize) return false;
+
+    OutSamples.Reset(NumSamples);
+    for (uint32 Index = 0; Index < NumSamples && !Reader.IsError(); ++Index)
+    {
+        Reader << OutSamples.AddDefaulted_GetRef();
+    }
+    return !Reader.IsError();
+}
+
+bool FVehicleTelemetryFile::ConvertToCsv(const FString& InPath, const FString& OutPath)
+{
+    FString VehicleName;
+    TArray<FVehicleTelemetrySample> Samples;
+    if (!Load(InPath, VehicleName, Samples))
+    {
+        UE_LOG(LogTemp, Error, TEXT("%s is not a vehicle telemetry file"), *InPath);
+        return false;
+    }
+
+    FString Csv = TEXT("Frame,Time,FrameTimeMs,Throttle,Steer,Brake,EngineRPM,Speed,TireSmoke,Handbrake\n");
+    for (const FVehicleTelemetrySample& Sample : Samples)
+    {
+        Csv += FString::Printf(TEXT("%u,%.4f,%.3f,%.3f,%.3f,%.3f,%.1f,%.1f,%d,%d\n"),
+            Sample.Frame, Sample.Time, Sample.FrameTime * 1000.0f, Sample.Throttle, Sample.Steer, Sample.Brake, Sample.EngineRPM, Sample.Speed,
+            EnumHasAnyFlags(Sample.Flags, EVehicleTelemetryFlags::TireSmoke) ? 1 : 0,
+            EnumHasAnyFlags(Sample.Flags, EVehicleTelemetryFlags::Handbrake) ? 1 : 0);
+    }
+
+    if (!FFileHelper::SaveStringToFile(Csv, *OutPath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Could not write %s"), *OutPath);
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("%s: %d samples of %s written to %s"), *InPath, Samples.Num(), *VehicleName, *OutPath);
+    return true;
+}
+
+static FAutoConsoleCommandWithWorldAndArgs VehicleTelemetryFlushCommand(
+    TEXT("Vehicle.Telemetry.Flush"),
+    TEXT("Writes the recorded telemetry of every vehicle that has been driven to Saved/Profiling/Telemetry. Usage: Vehicle.Telemetry.Flush [Reset=0]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (!World) return;
+
+        const bool bReset = Args.Num() > 0 && FCString::Atoi(*Args[0]) != 0;
+        const FString Stamp = FDateTime::Now().ToString();
+        int32 NumWritten = 0;
+        for (TActorIterator<AVehicleBase> It(World); It; ++It)
+        {
+            const FString Path = FPaths::ProfilingDir() / TEXT("Telemetry") / FString::Printf(TEXT("%s-%s.vtel"), *It->GetName(), *Stamp);
+            if (It->FlushTelemetry(Path, bReset))
+            {
+                ++NumWritten;
+            }
+        }
+        UE_LOG(LogTemp, Log, TEXT("Vehicle telemetry: wrote %d files to %s"), NumWritten, *(FPaths::ProfilingDir() / TEXT("Telemetry")));
+    }));
+
+static FAutoConsoleCommand VehicleTelemetryToCsvCommand(
+    TEXT("Vehicle.Telemetry.ToCsv"),
+    TEXT("Converts a vehicle telemetry file to CSV next to it. Usage: Vehicle.Telemetry.ToCsv <file.vtel>"),
+    FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+    {
+        if (Args.Num() < 1) return;
+        FVehicleTelemetryFile::ConvertToCsv(Args[0], FPaths::ChangeExtension(Args[0], TEXT("csv")));
+    }));
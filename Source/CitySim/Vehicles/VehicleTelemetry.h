@@ -0,0 +1,58 @@
+#pragma once
+#include "CoreMinimal.h"
+
+enum class EVehicleTelemetryFlags : uint8
+{
+    None = 0,
+    TireSmoke = 1 << 0,
+    Handbrake = 1 << 1
+};
+ENUM_CLASS_FLAGS(EVehicleTelemetryFlags);
+
+// One frame of a driven vehicle; 33 bytes on disk
+struct FVehicleTelemetrySample
+{
+    uint32 Frame = 0;
+    float Time = 0.0f;
+    float FrameTime = 0.0f;
+    float Throttle = 0.0f;
+    float Steer = 0.0f;
+    float Brake = 0.0f;
+    float EngineRPM = 0.0f;
+    float Speed = 0.0f;
+    EVehicleTelemetryFlags Flags = EVehicleTelemetryFlags::None;
+
+    friend FArchive& operator<<(FArchive& Ar, FVehicleTelemetrySample& Sample);
+};
+
+// The last Capacity samples of one vehicle. Storage is allocated once by Init; recording
+// overwrites the oldest sample and never allocates.
+class FVehicleTelemetryRing
+{
+public:
+    void Init(int32 Capacity);
+    bool IsInitialized() const { return Samples.Num() > 0; }
+    int32 Num() const { return Count; }
+
+    void Record(const FVehicleTelemetrySample& Sample);
+    void Reset();
+
+    // Binary file: header with the vehicle name, then the samples oldest first
+    bool Save(const FString& Path, const FString& VehicleName) const;
+
+private:
+    TArray<FVehicleTelemetrySample> Samples;
+    int32 Head = 0;  // Next slot to write
+    int32 Count = 0;
+};
+
+// Reader for files written by FVehicleTelemetryRing::Save; see also UVehicleTelemetryToCsvCommandlet
+struct FVehicleTelemetryFile
+{
+    static constexpr uint32 Magic = 0x4C455456; // "VTEL"
+    static constexpr uint32 Version = 1;
+    static constexpr int64 SampleSize = 33; // Bytes per FVehicleTelemetrySample on disk
+
+    static bool Load(const FString& Path, FString& OutVehicleName, TArray<FVehicleTelemetrySample>& OutSamples);
+    static bool ConvertToCsv(const FString& InPath, const FString& OutPath);
+};
@@ -0,0 +1,28 @@
+#include "Vehicles/VehicleTelemetryToCsvCommandlet.h"
+#include "Vehicles/VehicleTelemetry.h"
+#include "Misc/Paths.h"
+
+UVehicleTelemetryToCsvCommandlet::UVehicleTelemetryToCsvCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UVehicleTelemetryToCsvCommandlet::Main(const FString& Params)
+{
+    FString InPath;
+    if (!FParse::Value(*Params, TEXT("In="), InPath))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Usage: -run=VehicleTelemetryToCsv -In=<file.vtel> [-Out=<file.csv>]"));
+        return 1;
+    }
+
+    FString OutPath;
+    if (!FParse::Value(*Params, TEXT("Out="), OutPath))
+    {
+        OutPath = FPaths::ChangeExtension(InPath, TEXT("csv"));
+    }
+    return FVehicleTelemetryFile::ConvertToCsv(InPath, OutPath) ? 0 : 1;
+}
@@ -0,0 +1,17 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "VehicleTelemetryToCsvCommandlet.generated.h"
+
+// Offline conversion of a telemetry file to CSV, without starting the game:
+// UnrealEditor-Cmd BeLive.uproject -run=VehicleTelemetryToCsv -In=<file.vtel> [-Out=<file.csv>]
+UCLASS()
+class BELIVE_API UVehicleTelemetryToCsvCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UVehicleTelemetryToCsvCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,47 @@
+#include "World/RoadFrictionTable.h"
+
+void FRoadFrictionTable::Bake(TConstArrayView<FRoadSurfaceGrip> SurfaceGrip, float DefaultWetGrip, float DefaultSnowGrip)
+{
+    float WetGrip[NumSurfaces];
+    float SnowGrip[NumSurfaces];
+    for (int32 S = 0; S < NumSurfaces; ++S)
+    {
+        WetGrip[S] = DefaultWetGrip;
+        SnowGrip[S] = DefaultSnowGrip;
+    }
+    for (const FRoadSurfaceGrip& Grip : SurfaceGrip)
+    {
+        WetGrip[Grip.Surface] = Grip.WetGrip;
+        SnowGrip[Grip.Surface] = Grip.SnowGrip;
+    }
+
+    Multipliers.SetNumUninitialized(NumWeatherTypes * NumSurfaces);
+
+    for (int32 W = 0; W < NumWeatherTypes; ++W)
+    {
+        const FWeatherState& State = FWeatherState::GetPreset(static_cast<EWeatherType>(W));
+        for (int32 S = 0; S < NumSurfaces; ++S)
+        {
+            Multipliers[W * NumSurfaces + S] = Evaluate(State, WetGrip[S], SnowGrip[S]);
+        }
+    }
+}
+
+float FRoadFrictionTable::GetMultiplier(EPhysicalSurface Surface, EWeatherType Weather) const
+{
+    return GetRow(Weather)[Surface];
+}
+
+TConstArrayView<float> FRoadFrictionTable::GetRow(EWeatherType Weather) const
+{
+    check(IsBaked());
+    return MakeArrayView(&Multipliers[static_cast<int32>(Weather) * NumSurfaces], NumSurfaces);
+}
+
+float FRoadFrictionTable::Evaluate(const FWeatherState& State, float WetGrip, float SnowGrip)
+{
+    // Dry grip fades toward the wet and snowed-on values as rain and snow build up
+    const float Wet = FMath::Lerp(1.0f, WetGrip, FMath::Clamp(State.Rain, 0.0f, 1.0f));
+    const float Snow = FMath::Lerp(1.0f, SnowGrip, FMath::Clamp(State.Snow, 0.0f, 1.0f));
+    return Wet * Snow;
+}
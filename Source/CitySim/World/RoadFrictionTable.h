@@ -0,0 +1,45 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Chaos/ChaosEngineInterface.h"
+#include "World/WeatherTypes.h"
+#include "RoadFrictionTable.generated.h"
+
+// Grip a physical surface keeps, relative to dry, when soaked or snowed on
+USTRUCT(BlueprintType)
+struct FRoadSurfaceGrip
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Road Grip")
+    TEnumAsByte<EPhysicalSurface> Surface = SurfaceType_Default;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Road Grip", meta = (ClampMin = "0", ClampMax = "1"))
+    float WetGrip = 0.7f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Road Grip", meta = (ClampMin = "0", ClampMax = "1"))
+    float SnowGrip = 0.35f;
+};
+
+// Precomputed tire friction multipliers keyed by (physical surface, weather type).
+// Baked once so a weather change hands out a ready row instead of evaluating per wheel.
+class BELIVE_API FRoadFrictionTable
+{
+public:
+    static constexpr int32 NumSurfaces = SurfaceType_Max;
+
+    // Surfaces without an entry in SurfaceGrip use the defaults
+    void Bake(TConstArrayView<FRoadSurfaceGrip> SurfaceGrip, float DefaultWetGrip, float DefaultSnowGrip);
+    bool IsBaked() const { return Multipliers.Num() > 0; }
+
+    float GetMultiplier(EPhysicalSurface Surface, EWeatherType Weather) const;
+
+    // Every surface's multiplier under Weather, indexed by EPhysicalSurface
+    TConstArrayView<float> GetRow(EWeatherType Weather) const;
+
+    // Reference evaluation of one cell, used for baking
+    static float Evaluate(const FWeatherState& State, float WetGrip, float SnowGrip);
+
+private:
+    // Row per weather type, NumSurfaces columns
+    TArray<float> Multipliers;
+};
@@ -0,0 +1,125 @@
+#include "World/WeatherAudioVoiceManager.h"
+#include "World/WeatherManager.h"
+#include "Components/AudioComponent.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Weather Voices Active"), STAT_WeatherVoicesActive, STATGROUP_Weather);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Weather Voices Virtual"), STAT_WeatherVoicesVirtual, STATGROUP_Weather);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Weather Voice Starts/min"), STAT_WeatherVoiceStarts, STATGROUP_Weather);
+
+// Starts per minute are averaged over this many seconds
+static constexpr double VoiceStartWindow = 10.0;
+
+int32 FWeatherAudioVoiceManager::AddVoice(UAudioComponent* Component)
+{
+    FVoice& Voice = Voices.AddDefaulted_GetRef();
+    Voice.Component = Component;
+    return Voices.Num() - 1;
+}
+
+void FWeatherAudioVoiceManager::SetTargetVolume(int32 Voice, float Volume)
+{
+    if (Voices.IsValidIndex(Voice))
+    {
+        Voices[Voice].TargetVolume = Volume;
+    }
+}
+
+void FWeatherAudioVoiceManager::Update(double Now, bool bCanPlay)
+{
+    // Hysteresis: louder to start than to keep going
+    TArray<int32, TInlineAllocator<4>> Candidates;
+    for (int32 Index = 0; Index < Voices.Num(); ++Index)
+    {
+        FVoice& Voice = Voices[Index];
+        const float Threshold = Voice.bWantsToPlay ? ExitVolume : EnterVolume;
+        Voice.bWantsToPlay = Voice.Component.IsValid() && Voice.TargetVolume >= Threshold;
+        if (Voice.bWantsToPlay && bCanPlay)
+        {
+            Candidates.Add(Index);
+        }
+    }
+
+    // Loudest voices win the slots; already playing voices win ties so the cap doesn't flip-flop
+    Candidates.Sort([this](int32 A, int32 B)
+    {
+        const FVoice& VoiceA = Voices[A];
+        const FVoice& VoiceB = Voices[B];
+        if (!FMath::IsNearlyEqual(VoiceA.TargetVolume, VoiceB.TargetVolume, VolumeEpsilon))
+        {
+            return VoiceA.TargetVolume > VoiceB.TargetVolume;
+        }
+        return VoiceA.bPlaying && !VoiceB.bPlaying;
+    });
+    if (Candidates.Num() > MaxVoices)
+    {
+        Candidates.SetNum(FMath::Max(MaxVoices, 0));
+    }
+
+    ActiveCount = 0;
+    VirtualCount = 0;
+    for (int32 Index = 0; Index < Voices.Num(); ++Index)
+    {
+        FVoice& Voice = Voices[Index];
+        UAudioComponent* Component = Voice.Component.Get();
+        const bool bShouldPlay = Candidates.Contains(Index);
+
+        if (bShouldPlay)
+        {
+            if (!Voice.bPlaying)
+            {
+                Component->SetVolumeMultiplier(Voice.TargetVolume);
+                Component->FadeIn(FadeInTime, 1.0f);
+                Voice.AppliedVolume = Voice.TargetVolume;
+                Voice.bPlaying = true;
+                ++StartsThisWindow;
+            }
+            else if (!FMath::IsNearlyEqual(Voice.AppliedVolume, Voice.TargetVolume, VolumeEpsilon))
+            {
+                Component->SetVolumeMultiplier(Voice.TargetVolume);
+                Voice.AppliedVolume = Voice.TargetVolume;
+            }
+            ++ActiveCount;
+        }
+        else
+        {
+            if (Voice.bPlaying && Component)
+            {
+                // FadeOut stops the sound once the envelope reaches silence
+                Component->FadeOut(FadeOutTime, 0.0f);
+            }
+            Voice.bPlaying = false;
+            if (Voice.bWantsToPlay)
+            {
+                ++VirtualCount;
+            }
+        }
+    }
+
+    const double Elapsed = Now - WindowStart;
+    if (Elapsed >= VoiceStartWindow)
+    {
+        StartsPerMinute = FMath::RoundToInt(StartsThisWindow * 60.0 / Elapsed);
+        StartsThisWindow = 0;
+        WindowStart = Now;
+    }
+
+    SET_DWORD_STAT(STAT_WeatherVoicesActive, ActiveCount);
+    SET_DWORD_STAT(STAT_WeatherVoicesVirtual, VirtualCount);
+    SET_DWORD_STAT(STAT_WeatherVoiceStarts, StartsPerMinute);
+}
+
+void FWeatherAudioVoiceManager::StopAll()
+{
+    for (FVoice& Voice : Voices)
+    {
+        if (Voice.bPlaying && Voice.Component.IsValid())
+        {
+            Voice.Component->Stop();
+        }
+        Voice.bPlaying = false;
+        Voice.bWantsToPlay = false;
+        Voice.AppliedVolume = -1.0f;
+    }
+    ActiveCount = 0;
+    VirtualCount = 0;
+}
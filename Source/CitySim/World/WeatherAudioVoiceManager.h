@@ -0,0 +1,52 @@
+#pragma once
+#include "CoreMinimal.h"
+
+class UAudioComponent;
+
+// Starts and stops looping ambient weather voices (rain, wind) from a target volume per voice.
+// A voice starts when its target rises to EnterVolume and only stops once it drops below
+// ExitVolume, so values hovering around a threshold don't restart the sound. Voices that are
+// inaudible, or over the MaxVoices cap, are virtualized: their target keeps updating but
+// nothing plays until they win a slot back.
+class BELIVE_API FWeatherAudioVoiceManager
+{
+public:
+    float EnterVolume = 0.12f;
+    float ExitVolume = 0.05f;
+    float FadeInTime = 1.5f;
+    float FadeOutTime = 2.0f;
+    float VolumeEpsilon = 0.01f;
+    int32 MaxVoices = 2;
+
+    // Returns the handle used with SetTargetVolume
+    int32 AddVoice(UAudioComponent* Component);
+    void SetTargetVolume(int32 Voice, float Volume);
+
+    // Applies hysteresis, the voice cap and fades. bCanPlay false virtualizes every voice.
+    void Update(double Now, bool bCanPlay);
+
+    // Stops playing voices without a fade and forgets their state
+    void StopAll();
+
+    int32 GetActiveVoiceCount() const { return ActiveCount; }
+    int32 GetVirtualVoiceCount() const { return VirtualCount; }
+    int32 GetVoiceStartsPerMinute() const { return StartsPerMinute; }
+
+private:
+    struct FVoice
+    {
+        TWeakObjectPtr<UAudioComponent> Component;
+        float TargetVolume = 0.0f;
+        float AppliedVolume = -1.0f;
+        bool bWantsToPlay = false;
+        bool bPlaying = false;
+    };
+
+    TArray<FVoice> Voices;
+
+    int32 ActiveCount = 0;
+    int32 VirtualCount = 0;
+    int32 StartsThisWindow = 0;
+    int32 StartsPerMinute = 0;
+    double WindowStart = 0.0;
+};
@@ -0,0 +1,290 @@
+#include "World/WeatherBenchmark.h"
+#include "World/WeatherManager.h"
+#include "Engine/World.h"
+#include "Engine/DirectionalLight.h"
+#include "Engine/SkyAtmosphere.h"
+#include "Engine/ExponentialHeightFog.h"
+#include "HAL/PlatformMemory.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/DateTime.h"
+
+FWeatherProfileScope::FWeatherProfileScope(FWeatherProfile* InProfile, EWeatherProfileSection InSection)
+    : Profile(InProfile)
+    , Section(InSection)
+{
+    if (Profile)
+    {
+        StartCycles = FPlatformTime::Cycles64();
+    }
+}
+
+FWeatherProfileScope::~FWeatherProfileScope()
+{
+    if (Profile)
+    {
+        Profile->Cycles[static_cast<int32>(Section)].Add(FPlatformTime::Cycles64() - StartCycles);
+    }
+}
+
+bool FWeatherBenchmarkResult::SawEveryWeather() const
+{
+    return SeenWeather == (1u << NumWeatherTypes) - 1;
+}
+
+bool FWeatherBenchmarkResult::SawEveryTimeOfDay() const
+{
+    return SeenTimeOfDay == (1u << (static_cast<uint32>(ETimeOfDay::Midnight) + 1)) - 1;
+}
+
+const TCHAR* FWeatherBenchmark::GetSectionName(EWeatherProfileSection Section)
+{
+    switch (Section)
+    {
+    case EWeatherProfileSection::TransitionWeather: return TEXT("TransitionWeather");
+    case EWeatherProfileSection::UpdateLocalWeather: return TEXT("UpdateLocalWeather");
+    case EWeatherProfileSection::SampleLighting: return TEXT("SampleLighting");
+    case EWeatherProfileSection::UpdateSun: return TEXT("UpdateSun");
+    case EWeatherProfileSection::UpdateTimeOfDay: return TEXT("UpdateTimeOfDay");
+    case EWeatherProfileSection::UpdateAtmosphere: return TEXT("UpdateAtmosphere");
+    case EWeatherProfileSection::UpdateWeatherEffects: return TEXT("UpdateWeatherEffects");
+    case EWeatherProfileSection::UpdateLighting: return TEXT("UpdateLighting");
+    case EWeatherProfileSection::UpdateAudio: return TEXT("UpdateAudio");
+    case EWeatherProfileSection::UpdateWindEffects: return TEXT("UpdateWindEffects");
+    case EWeatherProfileSection::PublishWeatherParameters: return TEXT("PublishWeatherParameters");
+    case EWeatherProfileSection::CaptureRenderOutput: return TEXT("CaptureRenderOutput");
+    case EWeatherProfileSection::ApplyRenderOutput: return TEXT("ApplyRenderOutput");
+    default: return TEXT("Unknown");
+    }
+}
+
+namespace
+{
+    // Sorts Samples in place
+    double GetPercentileMicroseconds(TArray<uint64>& Samples, float Percentile)
+    {
+        if (Samples.Num() == 0) return 0.0;
+
+        Samples.Sort();
+        const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Samples.Num()) - 1, 0, Samples.Num() - 1);
+        return FPlatformTime::ToMilliseconds64(Samples[Index]) * 1000.0;
+    }
+
+    // Memory growth is only known per day; section rows leave it empty
+    FString FormatRow(const FString& Name, TArray<uint64>& Samples, const FString& UsedPhysicalDeltaKB = FString())
+    {
+        uint64 Total = 0;
+        for (const uint64 Sample : Samples)
+        {
+            Total += Sample;
+        }
+
+        const int32 Calls = Samples.Num();
+        const double MeanUs = Calls > 0 ? FPlatformTime::ToMilliseconds64(Total) * 1000.0 / Calls : 0.0;
+        const double P50Us = GetPercentileMicroseconds(Samples, 0.5f);
+        const double P99Us = GetPercentileMicroseconds(Samples, 0.99f);
+        const double MaxUs = Calls > 0 ? FPlatformTime::ToMilliseconds64(Samples.Last()) * 1000.0 : 0.0;
+
+        return FString::Printf(TEXT("%s,%d,%.3f,%.3f,%.3f,%.3f,%s\n"), *Name, Calls, MeanUs, P50Us, P99Us, MaxUs, *UsedPhysicalDeltaKB);
+    }
+
+    // Process-wide, so other threads' allocations show up too; only meaningful over a whole day
+    int64 GetUsedPhysicalBytes()
+    {
+        return static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical);
+    }
+
+    template <typename ActorType>
+    ActorType* SpawnStandIn(UWorld* World)
+    {
+        FActorSpawnParameters Params;
+        Params.ObjectFlags |= RF_Transient;
+        return World->SpawnActor<ActorType>(Params);
+    }
+}
+
+AWeatherManager* FWeatherBenchmark::SpawnManager(UWorld* World, float DeltaTime)
+{
+    // Stand-ins for the level's sun, sky and fog, so every push does the same work as in a lit level
+    ADirectionalLight* Sun = SpawnStandIn<ADirectionalLight>(World);
+    ASkyAtmosphere* SkyAtmosphere = SpawnStandIn<ASkyAtmosphere>(World);
+    AExponentialHeightFog* HeightFog = SpawnStandIn<AExponentialHeightFog>(World);
+
+    // Isolated before BeginPlay, so the level's manager, lighting and vehicle grip are left alone
+    AWeatherManager* Manager = World->SpawnActorDeferred<AWeatherManager>(AWeatherManager::StaticClass(), FTransform::Identity);
+    if (!Manager || !Sun || !SkyAtmosphere || !HeightFog)
+    {
+        if (Manager) Manager->Destroy();
+        if (Sun) Sun->Destroy();
+        if (SkyAtmosphere) SkyAtmosphere->Destroy();
+        if (HeightFog) HeightFog->Destroy();
+        return nullptr;
+    }
+    Manager->SetFlags(RF_Transient);
+    Manager->bIsolated = true;
+    Manager->Sun = Sun;
+    Manager->SkyAtmosphere = SkyAtmosphere;
+    Manager->HeightFog = HeightFog;
+    Manager->FinishSpawning(FTransform::Identity);
+
+    // The benchmark drives every step itself at the requested delta
+    Manager->SetActorTickEnabled(false);
+    Manager->bEnableDynamicWeather = false;
+    Manager->TimeAcceleration = 1.0f;
+    Manager->SimulationInterval = DeltaTime;
+    return Manager;
+}
+
+void FWeatherBenchmark::DestroyManager(AWeatherManager* Manager)
+{
+    Manager->Sun->Destroy();
+    Manager->SkyAtmosphere->Destroy();
+    Manager->HeightFog->Destroy();
+    Manager->Destroy();
+}
+
+bool FWeatherBenchmark::Run(UWorld* World, float DeltaTime, FWeatherBenchmarkResult& OutResult)
+{
+    OutResult = FWeatherBenchmarkResult();
+    if (!World || DeltaTime <= 0.0f) return false;
+
+    AWeatherManager* Manager = SpawnManager(World, DeltaTime);
+    if (!Manager) return false;
+
+    FWeatherProfile Profile;
+    TArray<uint64> StepCycles;
+    FString DayRows;
+
+    for (int32 TypeIndex = 0; TypeIndex < NumWeatherTypes; ++TypeIndex)
+    {
+        // Start each day at midnight already settled into the weather type
+        const EWeatherType Type = static_cast<EWeatherType>(TypeIndex);
+        Manager->SetWeather(Type);
+        Manager->SeekTime(0.0);
+
+        TArray<uint64> DayCycles;
+        const int64 StartUsedPhysical = GetUsedPhysicalBytes();
+        StepDay(Manager, DeltaTime, Profile, DayCycles, OutResult);
+        const int64 UsedPhysicalDelta = GetUsedPhysicalBytes() - StartUsedPhysical;
+
+        StepCycles.Append(DayCycles);
+        const FString DayName = FString::Printf(TEXT("Day:%s"), *UEnum::GetDisplayValueAsText(Type).ToString());
+        DayRows += FormatRow(DayName, DayCycles, FString::Printf(TEXT("%lld"), UsedPhysicalDelta / 1024));
+    }
+
+    DestroyManager(Manager);
+
+    if (!OutResult.SawEveryTimeOfDay())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Weather benchmark did not visit every time of day band (mask 0x%x)"), OutResult.SeenTimeOfDay);
+    }
+
+    FString Csv = TEXT("Section,Calls,MeanUs,P50Us,P99Us,MaxUs,UsedPhysicalDeltaKB\n");
+    for (int32 Index = 0; Index < static_cast<int32>(EWeatherProfileSection::Count); ++Index)
+    {
+        OutResult.SectionCalls[Index] = Profile.Cycles[Index].Num();
+        Csv += FormatRow(GetSectionName(static_cast<EWeatherProfileSection>(Index)), Profile.Cycles[Index]);
+    }
+    Csv += FormatRow(TEXT("Step"), StepCycles);
+    Csv += DayRows;
+
+    const FString Path = FPaths::ProfilingDir() / TEXT("Weather") / FString::Printf(TEXT("WeatherBenchmark-%s.csv"), *FDateTime::Now().ToString());
+    if (!FFileHelper::SaveStringToFile(Csv, *Path))
+    {
+        UE_LOG(LogTemp, Error, TEXT("Weather benchmark could not write %s"), *Path);
+        return false;
+    }
+
+    OutResult.CsvPath = Path;
+    UE_LOG(LogTemp, Log, TEXT("Weather benchmark: %d steps, results in %s"), OutResult.Steps, *Path);
+    return true;
+}
+
+bool FWeatherBenchmark::CompareLightingTable(UWorld* World, float DeltaTime, double& OutEvaluateStepUs, double& OutTableStepUs)
+{
+    OutEvaluateStepUs = OutTableStepUs = 0.0;
+    if (!World || DeltaTime <= 0.0f) return false;
+
+    AWeatherManager* Manager = SpawnManager(World, DeltaTime);
+    if (!Manager) return false;
+
+    // Alternate the setting per day so drift over the run hits both sides equally
+    uint64 Cycles[2] = {};
+    int32 Steps[2] = {};
+    const int32 NumSteps = FMath::CeilToInt(Manager->DayLengthSeconds / DeltaTime);
+    for (int32 TypeIndex = 0; TypeIndex < NumWeatherTypes; ++TypeIndex)
+    {
+        for (int32 UseTable = 0; UseTable < 2; ++UseTable)
+        {
+            const int32 Side = TypeIndex % 2 == 0 ? UseTable : 1 - UseTable;
+            Manager->bUseBakedLightingTable = Side == 1;
+            Manager->SetWeather(static_cast<EWeatherType>(TypeIndex));
+            Manager->SeekTime(0.0);
+
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            for (int32 Step = 0; Step < NumSteps; ++Step)
+            {
+                Manager->StepSimulation(DeltaTime);
+            }
+            Cycles[Side] += FPlatformTime::Cycles64() - StartCycles;
+            Steps[Side] += NumSteps;
+        }
+    }
+
+    DestroyManager(Manager);
+
+    OutEvaluateStepUs = FPlatformTime::ToMilliseconds64(Cycles[0]) * 1000.0 / Steps[0];
+    OutTableStepUs = FPlatformTime::ToMilliseconds64(Cycles[1]) * 1000.0 / Steps[1];
+    UE_LOG(LogTemp, Log, TEXT("Weather simulation step, %d steps each: %.3f us with bUseBakedLightingTable off, %.3f us on"),
+        Steps[0], OutEvaluateStepUs, OutTableStepUs);
+    return true;
+}
+
+void FWeatherBenchmark::StepDay(AWeatherManager* Manager, float DeltaTime, FWeatherProfile& Profile, TArray<uint64>& StepCycles, FWeatherBenchmarkResult& Result)
+{
+    const int32 NumSteps = FMath::CeilToInt(Manager->DayLengthSeconds / DeltaTime);
+    StepCycles.Reserve(StepCycles.Num() + NumSteps);
+
+    Manager->Profile = &Profile;
+    for (int32 Step = 0; Step < NumSteps; ++Step)
+    {
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+
+        // Same work as a visible frame: one simulation step, then the render push
+        Manager->PreviousOutput = Manager->CurrentOutput;
+        Manager->StepSimulation(DeltaTime);
+        {
+            FWeatherProfileScope Scope(&Profile, EWeatherProfileSection::ApplyRenderOutput);
+            Manager->ApplyRenderOutput(Manager->CurrentOutput);
+        }
+
+        StepCycles.Add(FPlatformTime::Cycles64() - StartCycles);
+        Result.SeenWeather |= 1u << static_cast<uint32>(Manager->Weather);
+        Result.SeenTimeOfDay |= 1u << static_cast<uint32>(Manager->GetCurrentTimeOfDay());
+    }
+    Result.Steps += NumSteps;
+    Manager->Profile = nullptr;
+}
+
+static FAutoConsoleCommandWithWorldAndArgs WeatherBenchmarkCommand(
+    TEXT("Weather.Benchmark"),
+    TEXT("Simulates a full day for every weather type at a fixed step and writes per-section timings to Saved/Profiling/Weather. Usage: Weather.Benchmark [DeltaTime=0.0166]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        const float DeltaTime = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 1.0f / 60.0f;
+        FWeatherBenchmarkResult Result;
+        FWeatherBenchmark::Run(World, DeltaTime, Result);
+    }));
+
+static FAutoConsoleCommandWithWorldAndArgs WeatherLightingTableBenchmarkCommand(
+    TEXT("Weather.LightingTable.Benchmark"),
+    TEXT("Times weather simulation steps over a full day for every weather type with bUseBakedLightingTable off and on. Usage: Weather.LightingTable.Benchmark [DeltaTime=0.0166]"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        const float DeltaTime = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 1.0f / 60.0f;
+        double EvaluateStepUs = 0.0;
+        double TableStepUs = 0.0;
+        FWeatherBenchmark::CompareLightingTable(World, DeltaTime, EvaluateStepUs, TableStepUs);
+    }));
@@ -0,0 +1,78 @@
+#pragma once
+#include "CoreMinimal.h"
+
+class AWeatherManager;
+
+// Sections of a weather simulation step timed by the benchmark
+enum class EWeatherProfileSection : uint8
+{
+    TransitionWeather,
+    UpdateLocalWeather,
+    SampleLighting,
+    UpdateSun,
+    UpdateTimeOfDay,
+    UpdateAtmosphere,
+    UpdateWeatherEffects,
+    UpdateLighting,
+    UpdateAudio,
+    UpdateWindEffects,
+    PublishWeatherParameters,
+    CaptureRenderOutput,
+    ApplyRenderOutput,
+    Count
+};
+
+// Per-section samples; only collected while a benchmark has one attached to a manager
+struct FWeatherProfile
+{
+    TArray<uint64> Cycles[static_cast<int32>(EWeatherProfileSection::Count)];
+};
+
+// Times one section into Profile; does nothing when Profile is null
+class FWeatherProfileScope
+{
+public:
+    FWeatherProfileScope(FWeatherProfile* InProfile, EWeatherProfileSection InSection);
+    ~FWeatherProfileScope();
+
+private:
+    FWeatherProfile* Profile;
+    EWeatherProfileSection Section;
+    uint64 StartCycles = 0;
+};
+
+// What a benchmark run covered, for callers that need to check it ran everything
+struct FWeatherBenchmarkResult
+{
+    FString CsvPath;
+    int32 Steps = 0;
+    uint32 SeenWeather = 0; // Bit per EWeatherType
+    uint32 SeenTimeOfDay = 0; // Bit per ETimeOfDay
+    int32 SectionCalls[static_cast<int32>(EWeatherProfileSection::Count)] = {};
+
+    bool SawEveryWeather() const;
+    bool SawEveryTimeOfDay() const;
+};
+
+// Runs a spawned weather manager through a full day for every weather type at a fixed step
+// and writes per-section timings (p50/p99) and memory growth to a CSV under Saved/Profiling.
+// Run headless with: -nullrhi -unattended -ExecCmds="Automation RunTests BeLive.Weather.Benchmark"
+class FWeatherBenchmark
+{
+public:
+    // False if the benchmark could not run or its CSV could not be written
+    static bool Run(UWorld* World, float DeltaTime, FWeatherBenchmarkResult& OutResult);
+
+    // Mean simulation step cost over a full day per weather type with bUseBakedLightingTable
+    // off (direct evaluation) and on (table lookup)
+    static bool CompareLightingTable(UWorld* World, float DeltaTime, double& OutEvaluateStepUs, double& OutTableStepUs);
+
+    static const TCHAR* GetSectionName(EWeatherProfileSection Section);
+
+private:
+    // Manager kept out of the live world, driving transient stand-in sun, sky and fog actors
+    static AWeatherManager* SpawnManager(UWorld* World, float DeltaTime);
+    static void DestroyManager(AWeatherManager* Manager);
+
+    static void StepDay(AWeatherManager* Manager, float DeltaTime, FWeatherProfile& Profile, TArray<uint64>& StepCycles, FWeatherBenchmarkResult& Result);
+};
@@ -0,0 +1,139 @@
+#include "World/WeatherLightingTable.h"
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveLinearColor.h"
+
+void FWeatherLightingTable::Bake(const FWeatherLightingBakeParams& Params)
+{
+    Samples.SetNumUninitialized(NumWeatherTypes * NumTimeSamples);
+    BakedParams = Params;
+
+    TArray<float, TInlineAllocator<8>> Edges;
+    GetBandEdges(Params, Edges);
+    EdgeColumns.Init(false, NumTimeSamples);
+    for (const float Edge : Edges)
+    {
+        // An edge exactly on a column is the end of the span before it as well
+        const float X = Edge * NumTimeSamples;
+        const int32 Column = FMath::FloorToInt(X);
+        EdgeColumns[Column % NumTimeSamples] = true;
+        if (FMath::IsNearlyEqual(X, static_cast<float>(Column)))
+        {
+            EdgeColumns[(Column + NumTimeSamples - 1) % NumTimeSamples] = true;
+        }
+    }
+
+    for (int32 W = 0; W < NumWeatherTypes; ++W)
+    {
+        const EWeatherType Weather = static_cast<EWeatherType>(W);
+        for (int32 I = 0; I < NumTimeSamples; ++I)
+        {
+            const float T = static_cast<float>(I) / NumTimeSamples;
+            Samples[W * NumTimeSamples + I] = Evaluate(T, Weather, Params);
+        }
+    }
+}
+
+FWeatherLightingSample FWeatherLightingTable::Sample(float NormalizedTime, EWeatherType Weather) const
+{
+    check(IsBaked());
+
+    // Linear interpolation between neighbouring columns, wrapping at midnight
+    const float X = FMath::Frac(NormalizedTime) * NumTimeSamples;
+    const int32 I0 = FMath::Min(FMath::FloorToInt(X), NumTimeSamples - 1);
+    const int32 I1 = (I0 + 1) % NumTimeSamples;
+    const float Alpha = X - I0;
+
+    if (EdgeColumns[I0])
+    {
+        return Evaluate(FMath::Frac(NormalizedTime), Weather, BakedParams);
+    }
+
+    const FWeatherLightingSample* Row = &Samples[static_cast<int32>(Weather) * NumTimeSamples];
+    return FWeatherLightingSample::Blend(Row[I0], Row[I1], Alpha);
+}
+
+FWeatherLightingSample FWeatherLightingTable::Evaluate(float T, EWeatherType Weather, const FWeatherLightingBakeParams& Params)
+{
+    FWeatherLightingSample Result;
+
+    // Sun intensity
+    if (Params.SunIntensityCurve)
+    {
+        Result.SunIntensity = Params.SunIntensityCurve->GetFloatValue(T) * Params.SunIntensity;
+    }
+    else if (T >= 0.25f && T <= 0.75f) // Day time
+    {
+        Result.SunIntensity = FMath::Sin((T - 0.25f) * PI * 2.0f) * Params.SunIntensity;
+        Result.SunIntensity = FMath::Clamp(Result.SunIntensity, 0.1f, Params.SunIntensity);
+    }
+    else // Night time
+    {
+        Result.SunIntensity = 0.05f; // Minimal night lighting
+    }
+
+    // Sun color
+    if (Params.SunColorCurve)
+    {
+        Result.SunColor = Params.SunColorCurve->GetLinearColorValue(T);
+    }
+    else
+    {
+        Result.SunColor = Params.SunColor;
+        if (T >= 0.4f && T <= 0.6f) // Midday
+        {
+            Result.SunColor = FLinearColor(1.0f, 1.0f, 1.0f); // Pure white
+        }
+        else if (T >= 0.6f && T <= 0.8f) // Evening
+        {
+            Result.SunColor = FLinearColor(1.0f, 0.7f, 0.5f); // Warm orange
+        }
+        else if (T >= 0.8f || T <= 0.2f) // Night
+        {
+            Result.SunColor = FLinearColor(0.3f, 0.4f, 0.8f); // Blue tint
+        }
+    }
+
+    // Sky color
+    if (Params.SkyColorCurve)
+    {
+        Result.SkyColor = Params.SkyColorCurve->GetLinearColorValue(T);
+    }
+    else
+    {
+        Result.SkyColor = Params.SkyColor;
+        if (T >= 0.4f && T <= 0.6f) // Midday
+        {
+            Result.SkyColor = FLinearColor(0.5f, 0.7f, 1.0f); // Bright blue
+        }
+        else if (T >= 0.6f && T <= 0.8f) // Evening
+        {
+            Result.SkyColor = FLinearColor(1.0f, 0.6f, 0.4f); // Orange sky
+        }
+        else if (T >= 0.8f || T <= 0.2f) // Night
+        {
+            Result.SkyColor = FLinearColor(0.1f, 0.1f, 0.3f); // Dark blue
+        }
+    }
+
+    // Weather influence on sky color
+    Result.SkyColor *= 1.0f - FWeatherState::GetPreset(Weather).SkyDarkening;
+
+    return Result;
+}
+
+void FWeatherLightingTable::GetBandEdges(const FWeatherLightingBakeParams& Params, TArray<float, TInlineAllocator<8>>& OutEdges)
+{
+    OutEdges.Reset();
+
+    // Curves are assumed continuous; only the built-in bands step
+    if (!Params.SunIntensityCurve)
+    {
+        // Day starts and ends, and the day-time sun leaves and rejoins its 0.1 floor
+        const float ClampOffset = FMath::Asin(FMath::Min(0.1f / FMath::Max(Params.SunIntensity, KINDA_SMALL_NUMBER), 1.0f)) / (2.0f * PI);
+        OutEdges.Append({ 0.25f, 0.25f + ClampOffset, 0.75f - ClampOffset, 0.75f });
+    }
+    if (!Params.SunColorCurve || !Params.SkyColorCurve)
+    {
+        OutEdges.Append({ 0.2f, 0.4f, 0.6f, 0.8f });
+    }
+}
@@ -0,0 +1,66 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "World/WeatherTypes.h"
+
+class UCurveFloat;
+class UCurveLinearColor;
+
+// Lighting targets for one (time, weather) cell
+struct FWeatherLightingSample
+{
+    float SunIntensity = 0.0f;
+    FLinearColor SunColor = FLinearColor::White;
+    FLinearColor SkyColor = FLinearColor::Blue;
+
+    static FWeatherLightingSample Blend(const FWeatherLightingSample& A, const FWeatherLightingSample& B, float Alpha)
+    {
+        FWeatherLightingSample Result;
+        Result.SunIntensity = FMath::Lerp(A.SunIntensity, B.SunIntensity, Alpha);
+        Result.SunColor = FMath::Lerp(A.SunColor, B.SunColor, Alpha);
+        Result.SkyColor = FMath::Lerp(A.SkyColor, B.SkyColor, Alpha);
+        return Result;
+    }
+};
+
+// Inputs the table is baked from. Curves are optional and replace the
+// built-in day/night bands when set (sampled over normalized time 0..1).
+struct FWeatherLightingBakeParams
+{
+    float SunIntensity = 1.0f;
+    FLinearColor SunColor = FLinearColor::White;
+    FLinearColor SkyColor = FLinearColor::Blue;
+
+    const UCurveFloat* SunIntensityCurve = nullptr;
+    const UCurveLinearColor* SunColorCurve = nullptr;
+    const UCurveLinearColor* SkyColorCurve = nullptr;
+};
+
+// Precomputed sun/sky targets keyed by (normalized time, weather type).
+// Baked once so the weather tick does a single lookup instead of branching.
+// Between columns the table interpolates linearly, within 1e-3 x SunIntensity of Evaluate for
+// the built-in bands (checked by BeLive.Weather.LightingTable). The few columns a band edge or the sun
+// intensity clamp falls in evaluate directly instead, so the hard steps between bands stay hard.
+class BELIVE_API FWeatherLightingTable
+{
+public:
+    static constexpr int32 NumTimeSamples = 128;
+
+    void Bake(const FWeatherLightingBakeParams& Params);
+    bool IsBaked() const { return Samples.Num() > 0; }
+
+    FWeatherLightingSample Sample(float NormalizedTime, EWeatherType Weather) const;
+
+    // Reference evaluation of the day/night bands, used for baking
+    static FWeatherLightingSample Evaluate(float NormalizedTime, EWeatherType Weather, const FWeatherLightingBakeParams& Params);
+
+    // Normalized times where Evaluate steps or has a kink, for the bands not replaced by curves
+    static void GetBandEdges(const FWeatherLightingBakeParams& Params, TArray<float, TInlineAllocator<8>>& OutEdges);
+
+private:
+    // Row per weather type, NumTimeSamples columns
+    TArray<FWeatherLightingSample> Samples;
+
+    // Columns whose span holds a band edge, and what to evaluate them with
+    TBitArray<> EdgeColumns;
+    FWeatherLightingBakeParams BakedParams;
+};
@@ -1,5 +1,5 @@
 #include "World/WeatherManager.h"
-#include "EngineUtils.h"
+#include "World/WeatherSubsystem.h"
 #include "Engine/DirectionalLight.h"
 #include "Components/LightComponent.h"
 #include "Kismet/GameplayStatics.h"
@@ -14,6 +14,33 @@
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "Math/UnrealMathUtility.h"
+#include "Engine/GameViewportClient.h"
+#include "Misc/App.h"
+#include "Curves/CurveFloat.h"
+#include "Curves/CurveLinearColor.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "NiagaraParameterCollection.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Sound/SoundBase.h"
+#include "AudioDevice.h"
+
+DECLARE_CYCLE_STAT(TEXT("WeatherManager Tick"), STAT_WeatherManagerTick, STATGROUP_Weather);
+DECLARE_CYCLE_STAT(TEXT("Weather Simulation Step"), STAT_WeatherSimulationStep, STATGROUP_Weather);
+
+// Times Call into the benchmark profile when one is attached
+#define WEATHER_PROFILE(Section, Call) { FWeatherProfileScope WeatherProfileScope(Profile, EWeatherProfileSection::Section); Call; }
+
+// Parameter names in the weather material and Niagara parameter collections
+namespace WeatherParameterNames
+{
+    static const FName Rain(TEXT("Rain"));
+    static const FName Snow(TEXT("Snow"));
+    static const FName WindIntensity(TEXT("WindIntensity"));
+    static const FName WindDirection(TEXT("WindDirection"));
+    static const FName Wetness(TEXT("Wetness"));
+    static const FName Fog(TEXT("Fog"));
+}
 
 AWeatherManager::AWeatherManager()
 {
@@ -50,324 +77,388 @@ AWeatherManager::AWeatherManager()
     WindAudio->bAutoActivate = false;
 }
 
+template <typename ValueType>
+bool AWeatherManager::ShouldPushRenderValue(EWeatherPushTarget Target, const ValueType& Value)
+{
+    return PushTracker.ShouldPush(Target, Value, GetWorld()->GetTimeSeconds());
+}
+
 void AWeatherManager::BeginPlay()
 {
     Super::BeginPlay();
 
-    // Find world components
-    for (TActorIterator<ADirectionalLight> It(GetWorld()); It; ++It)
+    // Register with the weather subsystem and pick up the sun, sky and fog from it.
+    // Actors assigned directly on this manager are registered on its behalf.
+    UWeatherSubsystem* WeatherSubsystem = bIsolated ? nullptr : GetWorld()->GetSubsystem<UWeatherSubsystem>();
+    if (WeatherSubsystem)
     {
-        Sun = *It; 
-        break;
+        WeatherSubsystem->RegisterWeatherManager(this);
+
+        if (Sun) WeatherSubsystem->RegisterSun(Sun);
+        if (SkyAtmosphere) WeatherSubsystem->RegisterSkyAtmosphere(SkyAtmosphere);
+        if (HeightFog) WeatherSubsystem->RegisterHeightFog(HeightFog);
+
+        WeatherActorsChangedHandle = WeatherSubsystem->OnWeatherActorsChanged.AddUObject(this, &AWeatherManager::RefreshWeatherActors);
+        RefreshWeatherActors();
+
+        // Levels from before registration components existed were found by an actor scan; nothing here means nothing gets lit
+        if (!Sun || !SkyAtmosphere || !HeightFog)
+        {
+            UE_LOG(LogTemp, Warning, TEXT("%s has no%s%s%s registered; add a WeatherRegistrationComponent to those actors or assign them on the manager"),
+                *GetName(), Sun ? TEXT("") : TEXT(" sun"), SkyAtmosphere ? TEXT("") : TEXT(" sky atmosphere"), HeightFog ? TEXT("") : TEXT(" height fog"));
+        }
     }
 
-    for (TActorIterator<ASkyAtmosphere> It(GetWorld()); It; ++It)
+    RebuildLightingTable();
+    RebuildFrictionTable();
+
+    // Global parameter collections every weather-aware material and VFX reads from
+    if (WeatherMaterialParameters)
     {
-        SkyAtmosphere = *It;
-        break;
+        MaterialParameterInstance = GetWorld()->GetParameterCollectionInstance(WeatherMaterialParameters);
     }
 
-    for (TActorIterator<AExponentialHeightFog> It(GetWorld()); It; ++It)
+    if (WeatherNiagaraParameters)
     {
-        HeightFog = *It;
-        break;
+        NiagaraParameterInstance = UNiagaraFunctionLibrary::GetNiagaraParameterCollection(GetWorld(), WeatherNiagaraParameters);
     }
 
+    // Rain and wind loops go through the voice manager instead of starting and stopping directly
+    RainVoice = AudioVoices.AddVoice(RainAudio);
+    WindVoice = AudioVoices.AddVoice(WindAudio);
+
     // Setup initial weather
+    ScheduleTime = TimeAccum;
+    InitialWeather = Weather;
+    InitialWeatherSlot = WeatherChangeInterval > 0.0f ? GetWeatherSlot(ScheduleTime) : 0;
+    CurrentWeatherSlot = InitialWeatherSlot;
     TargetWeather = Weather;
+    bWeatherTransitioning = false;
+    CurrentState = FWeatherState::GetPreset(Weather);
+    TransitionStartState = CurrentState;
+    UpdateLocalWeather();
     ApplyWeather(Weather);
     SetupWeatherEffects();
-}
-
-void AWeatherManager::Tick(float DT)
-{
-    Super::Tick(DT);
 
-    if (DayLengthSeconds <= 1.f) return;
+    LightningStream.Initialize(WeatherSeed);
+    CreateLightningPool();
+    UpdateLightningSchedule();
 
-    // Update time
-    TimeAccum = FMath::Fmod(TimeAccum + (DT * TimeAcceleration), DayLengthSeconds);
-    const float T = TimeAccum / DayLengthSeconds; // 0..1
+    CaptureRenderOutput();
+    PreviousOutput = CurrentOutput;
 
-    UpdateSun(T);
-    UpdateTimeOfDay(T);
-    UpdateAtmosphere();
-    UpdateWeatherEffects(DT);
-    UpdateLighting(DT);
-    UpdateAudio(DT);
-    UpdateWindEffects(DT);
-    UpdateLightningEffects(DT);
-    TransitionWeather(DT);
-
-    // Dynamic weather changes
-    if (bEnableDynamicWeather)
-    {
-        WeatherChangeTimer += DT;
-        if (WeatherChangeTimer >= WeatherChangeInterval)
-        {
-            ChangeWeatherRandomly();
-            WeatherChangeTimer = 0.0f;
-        }
+    // Nothing to interpolate for when the output can never be seen
+    if (!IsWeatherOutputVisible())
+    {
+        SetActorTickInterval(SimulationInterval);
     }
 }
 
-void AWeatherManager::UpdateSun(float T)
+void AWeatherManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    if (!Sun) return;
-
-    // Enhanced sun movement with smooth transitions
-    const float Pitch = FMath::Lerp(-20.f, 200.f, T); // below horizon → overhead → set
-    const float Yaw = FMath::Lerp(0.f, 360.f, T); // full rotation
-    FRotator R(Pitch, Yaw, 0.f);
-    Sun->SetActorRotation(R);
+    GetWorldTimerManager().ClearAllTimersForObject(this);
+    AudioVoices.StopAll();
 
-    // Dynamic sun intensity based on time of day
-    float Intensity = 0.0f;
-    if (T >= 0.25f && T <= 0.75f) // Day time
-    {
-        Intensity = FMath::Sin((T - 0.25f) * PI * 2.0f) * SunIntensity;
-        Intensity = FMath::Clamp(Intensity, 0.1f, SunIntensity);
-    }
-    else if (T > 0.75f || T < 0.25f) // Night time
+    UWeatherSubsystem* WeatherSubsystem = bIsolated ? nullptr : GetWorld()->GetSubsystem<UWeatherSubsystem>();
+    if (WeatherSubsystem)
     {
-        Intensity = 0.05f; // Minimal night lighting
+        WeatherSubsystem->OnWeatherActorsChanged.Remove(WeatherActorsChangedHandle);
+        WeatherSubsystem->UnregisterWeatherManager(this);
     }
 
-    CurrentSunIntensity = FMath::FInterpTo(CurrentSunIntensity, Intensity, GetWorld()->GetDeltaSeconds(), 1.0f);
+    Super::EndPlay(EndPlayReason);
+}
 
-    if (auto* LC = Sun->GetLightComponent())
+void AWeatherManager::RefreshWeatherActors()
+{
+    if (const UWeatherSubsystem* WeatherSubsystem = GetWorld()->GetSubsystem<UWeatherSubsystem>())
     {
-        LC->SetIntensity(40000.f * CurrentSunIntensity);
-        
-        // Dynamic sun color
-        FLinearColor TargetColor = SunColor;
-        if (T >= 0.4f && T <= 0.6f) // Midday
-        {
-            TargetColor = FLinearColor(1.0f, 1.0f, 1.0f); // Pure white
-        }
-        else if (T >= 0.6f && T <= 0.8f) // Evening
-        {
-            TargetColor = FLinearColor(1.0f, 0.7f, 0.5f); // Warm orange
-        }
-        else if (T >= 0.8f || T <= 0.2f) // Night
-        {
-            TargetColor = FLinearColor(0.3f, 0.4f, 0.8f); // Blue tint
-        }
-
-        CurrentSunColor = FMath::Lerp(CurrentSunColor, TargetColor, GetWorld()->GetDeltaSeconds() * 0.5f);
-        LC->SetLightColor(CurrentSunColor);
+        Sun = WeatherSubsystem->GetSun();
+        SkyAtmosphere = WeatherSubsystem->GetSkyAtmosphere();
+        HeightFog = WeatherSubsystem->GetHeightFog();
+        PushTracker.Invalidate();
     }
 }
 
-void AWeatherManager::UpdateAtmosphere()
+void AWeatherManager::Tick(float DT)
 {
-    if (SkyAtmosphere)
+    Super::Tick(DT);
+    SCOPE_CYCLE_COUNTER(STAT_WeatherManagerTick);
+
+    if (DayLengthSeconds <= 1.f) return;
+
+    PushTracker.Epsilon = RenderPushEpsilon;
+    PushTracker.MaxStaleness = RenderPushMaxStaleness;
+    PushTracker.UpdateCounters(GetWorld()->GetTimeSeconds());
+
+    // Advance the weather model at a fixed low rate. Time beyond the step cap is
+    // dropped so a long hitch doesn't trigger a burst of catch-up steps.
+    const float Interval = FMath::Max(SimulationInterval, 0.01f);
+    SimulationAccumulator = FMath::Min(SimulationAccumulator + DT, Interval * MaxSimulationStepsPerFrame);
+    while (SimulationAccumulator >= Interval)
     {
-        // Update sky atmosphere based on weather and time
-        float SkyIntensity = FMath::Lerp(0.3f, 1.0f, CurrentSunIntensity);
-        SkyAtmosphere->SetMieScatteringScale(SkyIntensity);
-        SkyAtmosphere->SetRayleighScatteringScale(SkyIntensity);
+        SimulationAccumulator -= Interval;
+        PreviousOutput = CurrentOutput;
+        StepSimulation(Interval);
     }
 
-    if (HeightFog)
+    // Per frame only blend the last two steps, and only if someone can see it
+    if (IsWeatherOutputVisible())
     {
-        // Update fog based on weather
-        float TargetFogDensity = 0.0f;
-        switch (Weather)
-        {
-            case EWeatherType::Foggy:
-                TargetFogDensity = FogDensity;
-                break;
-            case EWeatherType::HeavyRain:
-            case EWeatherType::Stormy:
-                TargetFogDensity = FogDensity * 0.7f;
-                break;
-            case EWeatherType::LightRain:
-                TargetFogDensity = FogDensity * 0.3f;
-                break;
-            default:
-                TargetFogDensity = 0.0f;
-                break;
-        }
-
-        CurrentFogDensity = FMath::FInterpTo(CurrentFogDensity, TargetFogDensity, GetWorld()->GetDeltaSeconds(), 0.5f);
-        HeightFog->SetFogDensity(CurrentFogDensity);
+        ApplyRenderOutput(FWeatherRenderOutput::Blend(PreviousOutput, CurrentOutput, SimulationAccumulator / Interval));
     }
 }
 
-void AWeatherManager::UpdateWeatherEffects(float DeltaTime)
+void AWeatherManager::StepSimulation(float DT)
 {
-    // Update rain effects
-    if (bEnableRainEffects)
+    SCOPE_CYCLE_COUNTER(STAT_WeatherSimulationStep);
+
+    // Update time
+    ScheduleTime += DT * TimeAcceleration;
+    TimeAccum = static_cast<float>(FMath::Fmod(ScheduleTime, static_cast<double>(DayLengthSeconds)));
+    const float T = TimeAccum / DayLengthSeconds; // 0..1
+
+    // Blended weather targets every update below reads from
+    WEATHER_PROFILE(TransitionWeather, TransitionWeather(DT));
+    WEATHER_PROFILE(UpdateLocalWeather, UpdateLocalWeather());
+
+    FWeatherLightingSample Lighting;
+    WEATHER_PROFILE(SampleLighting, Lighting = SampleLighting(T));
+
+    WEATHER_PROFILE(UpdateSun, UpdateSun(DT, Lighting));
+    WEATHER_PROFILE(UpdateTimeOfDay, UpdateTimeOfDay(T));
+    WEATHER_PROFILE(UpdateAtmosphere, UpdateAtmosphere(DT));
+    WEATHER_PROFILE(UpdateWeatherEffects, UpdateWeatherEffects(DT));
+    WEATHER_PROFILE(UpdateLighting, UpdateLighting(DT, Lighting));
+    WEATHER_PROFILE(UpdateAudio, UpdateAudio(DT));
+    WEATHER_PROFILE(UpdateWindEffects, UpdateWindEffects(DT));
+    WEATHER_PROFILE(PublishWeatherParameters, PublishWeatherParameters());
+
+    // Dynamic weather changes at each slot of the seeded schedule
+    if (bEnableDynamicWeather && WeatherChangeInterval > 0.0f)
     {
-        float RainIntensity = 0.0f;
-        switch (Weather)
+        const int64 Slot = GetWeatherSlot(ScheduleTime);
+        if (Slot != CurrentWeatherSlot)
         {
-            case EWeatherType::LightRain:
-                RainIntensity = 0.3f;
-                break;
-            case EWeatherType::HeavyRain:
-            case EWeatherType::Stormy:
-                RainIntensity = 1.0f;
-                break;
+            CurrentWeatherSlot = Slot;
+            ChangeWeatherRandomly();
         }
-        UpdateRainIntensity(RainIntensity);
     }
 
-    // Update snow effects
-    if (bEnableSnowEffects)
-    {
-        float SnowIntensity = (Weather == EWeatherType::Snowy) ? 1.0f : 0.0f;
-        UpdateSnowIntensity(SnowIntensity);
-    }
+    WEATHER_PROFILE(CaptureRenderOutput, CaptureRenderOutput());
 }
 
-void AWeatherManager::UpdateLighting(float DeltaTime)
+FWeatherLightingSample AWeatherManager::SampleLighting(float T) const
 {
-    // Update sky color based on time and weather
-    FLinearColor TargetSkyColor = SkyColor;
-    
-    float T = GetNormalizedTime();
-    if (T >= 0.4f && T <= 0.6f) // Midday
+    // One lookup for all time/weather dependent lighting targets
+    auto SampleWeather = [this, T](EWeatherType Type)
     {
-        TargetSkyColor = FLinearColor(0.5f, 0.7f, 1.0f); // Bright blue
-    }
-    else if (T >= 0.6f && T <= 0.8f) // Evening
+        return bUseBakedLightingTable
+            ? LightingTable.Sample(T, Type)
+            : FWeatherLightingTable::Evaluate(T, Type, LightingBakeParams);
+    };
+
+    if (!bWeatherTransitioning)
     {
-        TargetSkyColor = FLinearColor(1.0f, 0.6f, 0.4f); // Orange sky
+        return SampleWeather(Weather);
     }
-    else if (T >= 0.8f || T <= 0.2f) // Night
+
+    // Like CurrentState, blend from wherever lighting stood when the transition (re)started
+    return FWeatherLightingSample::Blend(TransitionStartLighting, SampleWeather(TargetWeather), WeatherTransitionAlpha);
+}
+
+void AWeatherManager::CaptureRenderOutput()
+{
+    CurrentOutput.NormalizedTime = GetNormalizedTime();
+    CurrentOutput.SunIntensity = CurrentSunIntensity;
+    CurrentOutput.SunColor = CurrentSunColor;
+    CurrentOutput.SkyColor = CurrentSkyColor;
+    CurrentOutput.FogDensity = CurrentFogDensity;
+}
+
+bool AWeatherManager::IsWeatherOutputVisible() const
+{
+    if (!FApp::CanEverRender() || IsNetMode(NM_DedicatedServer))
     {
-        TargetSkyColor = FLinearColor(0.1f, 0.1f, 0.3f); // Dark blue
+        return false;
     }
 
-    // Weather influence on sky color
-    switch (Weather)
+    const UGameViewportClient* Viewport = GetWorld()->GetGameViewport();
+    return !Viewport || !Viewport->bDisableWorldRendering;
+}
+
+bool AWeatherManager::IsWeatherAudioAudible() const
+{
+    if (IsNetMode(NM_DedicatedServer))
     {
-        case EWeatherType::Stormy:
-        case EWeatherType::HeavyRain:
-            TargetSkyColor *= 0.5f; // Darker sky
-            break;
-        case EWeatherType::Foggy:
-            TargetSkyColor *= 0.7f; // Muted sky
-            break;
+        return false;
     }
 
-    CurrentSkyColor = FMath::Lerp(CurrentSkyColor, TargetSkyColor, DeltaTime * 0.5f);
-    UpdateSkyAtmosphere();
+    const FAudioDeviceHandle AudioDevice = GetWorld()->GetAudioDevice();
+    return AudioDevice.IsValid();
 }
 
-void AWeatherManager::UpdateAudio(float DeltaTime)
+void AWeatherManager::ApplyRenderOutput(const FWeatherRenderOutput& Output)
 {
-    // Update rain audio
-    if (RainAudio)
+    if (Sun)
     {
-        float RainVolume = 0.0f;
-        switch (Weather)
-        {
-            case EWeatherType::LightRain:
-                RainVolume = 0.3f;
-                break;
-            case EWeatherType::HeavyRain:
-            case EWeatherType::Stormy:
-                RainVolume = 0.8f;
-                break;
-        }
+        // Enhanced sun movement with smooth transitions
+        const float Pitch = FMath::Lerp(-20.f, 200.f, Output.NormalizedTime); // below horizon → overhead → set
+        const float Yaw = FMath::Lerp(0.f, 360.f, Output.NormalizedTime); // full rotation
+        FRotator R(Pitch, Yaw, 0.f);
+        Sun->SetActorRotation(R);
 
-        if (RainVolume > 0.0f)
+        if (auto* LC = Sun->GetLightComponent())
         {
-            if (!RainAudio->IsPlaying())
+            if (ShouldPushRenderValue(EWeatherPushTarget::SunIntensity, Output.SunIntensity))
             {
-                RainAudio->Play();
+                LC->SetIntensity(40000.f * Output.SunIntensity);
             }
-            RainAudio->SetVolumeMultiplier(RainVolume);
-        }
-        else
-        {
-            if (RainAudio->IsPlaying())
+
+            if (ShouldPushRenderValue(EWeatherPushTarget::SunColor, Output.SunColor))
             {
-                RainAudio->Stop();
+                LC->SetLightColor(Output.SunColor);
             }
         }
     }
 
-    // Update wind audio
-    if (WindAudio && bEnableWindEffects)
+    UpdateSkyAtmosphere(Output);
+    UpdateFogDensity(Output.FogDensity);
+}
+
+void AWeatherManager::UpdateSun(float DeltaTime, const FWeatherLightingSample& Lighting)
+{
+    // Smoothed sun intensity and color; pushed to the light in ApplyRenderOutput
+    CurrentSunIntensity = FMath::FInterpTo(CurrentSunIntensity, Lighting.SunIntensity, DeltaTime, 1.0f);
+    CurrentSunColor = FMath::Lerp(CurrentSunColor, Lighting.SunColor, DeltaTime * 0.5f);
+}
+
+void AWeatherManager::UpdateAtmosphere(float DeltaTime)
+{
+    // Update fog based on weather
+    const float TargetFogDensity = FogDensity * LocalState.Fog;
+    CurrentFogDensity = FMath::FInterpTo(CurrentFogDensity, TargetFogDensity, DeltaTime, 0.5f);
+}
+
+void AWeatherManager::UpdateWeatherEffects(float DeltaTime)
+{
+    // Update rain effects
+    if (bEnableRainEffects)
+    {
+        CurrentRainIntensity = LocalState.Rain;
+        UpdateRainIntensity(CurrentRainIntensity);
+    }
+
+    // Update snow effects
+    if (bEnableSnowEffects)
     {
-        float WindVolume = CurrentWindIntensity * 0.5f;
-        if (WindVolume > 0.1f)
-        {
-            if (!WindAudio->IsPlaying())
-            {
-                WindAudio->Play();
-            }
-            WindAudio->SetVolumeMultiplier(WindVolume);
-        }
-        else
-        {
-            if (WindAudio->IsPlaying())
-            {
-                WindAudio->Stop();
-            }
-        }
+        CurrentSnowIntensity = LocalState.Snow;
+        UpdateSnowIntensity(CurrentSnowIntensity);
     }
+
+    // Surfaces soak up rain quickly and dry out slowly
+    const float WetnessRate = CurrentRainIntensity > CurrentWetness ? WetnessBuildRate : WetnessDryRate;
+    CurrentWetness = FMath::FInterpConstantTo(CurrentWetness, CurrentRainIntensity, DeltaTime, WetnessRate);
+}
+
+void AWeatherManager::UpdateLighting(float DeltaTime, const FWeatherLightingSample& Lighting)
+{
+    // Sky color based on time and weather comes from the lighting table
+    CurrentSkyColor = FMath::Lerp(CurrentSkyColor, Lighting.SkyColor, DeltaTime * 0.5f);
+}
+
+void AWeatherManager::UpdateAudio(float DeltaTime)
+{
+    AudioVoices.EnterVolume = AmbientAudioEnterVolume;
+    AudioVoices.ExitVolume = FMath::Min(AmbientAudioExitVolume, AmbientAudioEnterVolume);
+    AudioVoices.FadeInTime = AmbientAudioFadeInTime;
+    AudioVoices.FadeOutTime = AmbientAudioFadeOutTime;
+    AudioVoices.MaxVoices = MaxAmbientAudioVoices;
+
+    AudioVoices.SetTargetVolume(RainVoice, LocalState.RainVolume);
+    AudioVoices.SetTargetVolume(WindVoice, bEnableWindEffects ? CurrentWindIntensity * 0.5f : 0.0f);
+    AudioVoices.Update(GetWorld()->GetTimeSeconds(), IsWeatherAudioAudible());
 }
 
 void AWeatherManager::UpdateWindEffects(float DeltaTime)
 {
     if (!bEnableWindEffects) return;
 
-    float TargetWindIntensity = 0.0f;
-    switch (Weather)
-    {
-        case EWeatherType::Stormy:
-            TargetWindIntensity = WindIntensity * 2.0f;
-            break;
-        case EWeatherType::HeavyRain:
-            TargetWindIntensity = WindIntensity * 1.5f;
-            break;
-        case EWeatherType::LightRain:
-            TargetWindIntensity = WindIntensity * 0.5f;
-            break;
-    }
+    const float TargetWindIntensity = WindIntensity * LocalState.Wind;
 
     CurrentWindIntensity = FMath::FInterpTo(CurrentWindIntensity, TargetWindIntensity, DeltaTime, 0.5f);
     UpdateWindIntensity(CurrentWindIntensity);
 }
 
-void AWeatherManager::UpdateLightningEffects(float DeltaTime)
+void AWeatherManager::UpdateLocalWeather()
 {
-    if (!bEnableLightningEffects || Weather != EWeatherType::Stormy) return;
+    // Zones are only evaluated where the camera is; everything else keeps the global weather
+    const UWeatherSubsystem* WeatherSubsystem = GetWorld()->GetSubsystem<UWeatherSubsystem>();
+    LocalState = WeatherSubsystem ? WeatherSubsystem->GetWeatherStateAtLocation(GetViewLocation()) : CurrentState;
+}
 
-    float CurrentTime = GetWorld()->GetTimeSeconds();
-    if (CurrentTime - LastLightningTime > LightningInterval)
+FVector AWeatherManager::GetViewLocation() const
+{
+    if (const APlayerCameraManager* CameraManager = UGameplayStatics::GetPlayerCameraManager(this, 0))
     {
-        TriggerLightning();
-        LastLightningTime = CurrentTime;
-        LightningInterval = FMath::RandRange(5.0f, 15.0f); // Random interval
+        return CameraManager->GetCameraLocation();
     }
+    return GetActorLocation();
 }
 
 void AWeatherManager::TransitionWeather(float DeltaTime)
 {
-    if (Weather == TargetWeather) return;
+    if (!bWeatherTransitioning)
+    {
+        WeatherTransitionAlpha = 0.0f;
+        CurrentState = FWeatherState::GetPreset(Weather);
+        return;
+    }
 
+    // Blend from wherever the last transition left off toward the target preset
     WeatherTransitionTimer += DeltaTime;
-    float Alpha = FMath::Clamp(WeatherTransitionTimer / WeatherTransitionDuration, 0.0f, 1.0f);
+    WeatherTransitionAlpha = WeatherTransitionDuration > 0.0f
+        ? FMath::Clamp(WeatherTransitionTimer / WeatherTransitionDuration, 0.0f, 1.0f)
+        : 1.0f;
+    CurrentState = FWeatherState::Blend(TransitionStartState, FWeatherState::GetPreset(TargetWeather), WeatherTransitionAlpha);
 
-    if (Alpha >= 1.0f)
+    if (WeatherTransitionAlpha >= 1.0f)
     {
+        // A reversal lands back on the weather it started from; nothing to announce
+        const bool bWeatherChanged = Weather != TargetWeather;
         Weather = TargetWeather;
+        bWeatherTransitioning = false;
         WeatherTransitionTimer = 0.0f;
-        ApplyWeather(Weather);
+        WeatherTransitionAlpha = 0.0f;
+        if (bWeatherChanged)
+        {
+            ApplyWeather(Weather);
+        }
+    }
+}
+
+int64 AWeatherManager::GetWeatherSlot(double Time) const
+{
+    return FMath::FloorToInt64(Time / WeatherChangeInterval);
+}
+
+EWeatherType AWeatherManager::GetScheduledWeather(int64 Slot) const
+{
+    // The slot the manager started in keeps the placed weather
+    if (Slot == InitialWeatherSlot)
+    {
+        return InitialWeather;
     }
+
+    static const EWeatherType WeatherTypes[] = { EWeatherType::Clear, EWeatherType::Cloudy, EWeatherType::LightRain, EWeatherType::Foggy };
+    FRandomStream Stream(HashCombine(GetTypeHash(WeatherSeed), GetTypeHash(Slot)));
+    return WeatherTypes[Stream.RandRange(0, UE_ARRAY_COUNT(WeatherTypes) - 1)];
 }
 
 void AWeatherManager::ChangeWeatherRandomly()
 {
-    TArray<EWeatherType> WeatherTypes = { EWeatherType::Clear, EWeatherType::Cloudy, EWeatherType::LightRain, EWeatherType::Foggy };
-    EWeatherType NewWeather = WeatherTypes[FMath::RandRange(0, WeatherTypes.Num() - 1)];
-    
+    EWeatherType NewWeather = GetScheduledWeather(CurrentWeatherSlot);
+
     // Don't change to the same weather
     if (NewWeather != Weather)
     {
@@ -377,13 +468,109 @@ void AWeatherManager::ChangeWeatherRandomly()
 
 void AWeatherManager::SetWeather(EWeatherType NewWeather)
 {
+    // Already settled there
+    if (!bWeatherTransitioning && NewWeather == Weather) return;
+
+    // Blend from the current mix, which may be partway to another weather, including back to Weather
+    TransitionStartState = CurrentState;
+    if (HasActorBegunPlay())
+    {
+        TransitionStartLighting = SampleLighting(GetNormalizedTime());
+    }
     TargetWeather = NewWeather;
+    bWeatherTransitioning = true;
     WeatherTransitionTimer = 0.0f;
+    UpdateLightningSchedule();
 }
 
 void AWeatherManager::SetTimeOfDay(float NormalizedTime)
 {
-    TimeAccum = NormalizedTime * DayLengthSeconds;
+    // Seek within the current day
+    const double DayStart = ScheduleTime - TimeAccum;
+    SeekTime(DayStart + FMath::Clamp(NormalizedTime, 0.0f, 1.0f) * DayLengthSeconds);
+}
+
+void AWeatherManager::SkipToTimeOfDay(float NormalizedTime)
+{
+    // Always forward, to the next time the clock shows NormalizedTime
+    double Target = ScheduleTime - TimeAccum + FMath::Frac(NormalizedTime) * DayLengthSeconds;
+    if (Target <= ScheduleTime)
+    {
+        Target += DayLengthSeconds;
+    }
+    SeekTime(Target);
+}
+
+void AWeatherManager::FastForward(float GameSeconds)
+{
+    SeekTime(ScheduleTime + FMath::Max(GameSeconds, 0.0f));
+}
+
+void AWeatherManager::SeekTime(double NewTime)
+{
+    if (DayLengthSeconds <= 1.f) return;
+
+    ScheduleTime = FMath::Max(NewTime, 0.0);
+    TimeAccum = static_cast<float>(FMath::Fmod(ScheduleTime, static_cast<double>(DayLengthSeconds)));
+
+    // BeginPlay picks the clock up from here
+    if (!HasActorBegunPlay()) return;
+
+    const float T = GetNormalizedTime();
+
+    // Weather at the new time straight from the seeded schedule: the slot's weather,
+    // possibly still blending in from the previous slot
+    float SecondsSinceChange = TNumericLimits<float>::Max();
+    EWeatherType PreviousWeather = TargetWeather;
+    if (bEnableDynamicWeather && WeatherChangeInterval > 0.0f)
+    {
+        CurrentWeatherSlot = GetWeatherSlot(ScheduleTime);
+        PreviousWeather = GetScheduledWeather(CurrentWeatherSlot - 1);
+        const double SlotStart = CurrentWeatherSlot * static_cast<double>(WeatherChangeInterval);
+        SecondsSinceChange = static_cast<float>(ScheduleTime - SlotStart) / FMath::Max(TimeAcceleration, KINDA_SMALL_NUMBER);
+
+        Weather = PreviousWeather;
+        TargetWeather = GetScheduledWeather(CurrentWeatherSlot);
+        bWeatherTransitioning = Weather != TargetWeather;
+        TransitionStartState = FWeatherState::GetPreset(PreviousWeather);
+        TransitionStartLighting = bUseBakedLightingTable
+            ? LightingTable.Sample(T, PreviousWeather)
+            : FWeatherLightingTable::Evaluate(T, PreviousWeather, LightingBakeParams);
+        WeatherTransitionTimer = SecondsSinceChange;
+    }
+    else
+    {
+        // Let any running transition finish
+        TransitionStartState = CurrentState;
+        WeatherTransitionTimer = WeatherTransitionDuration;
+    }
+    TransitionWeather(0.0f);
+    UpdateLocalWeather();
+
+    // Smoothed values are placed where they settle instead of easing in over many steps
+    const FWeatherLightingSample Lighting = SampleLighting(T);
+    CurrentSunIntensity = Lighting.SunIntensity;
+    CurrentSunColor = Lighting.SunColor;
+    CurrentSkyColor = Lighting.SkyColor;
+    CurrentFogDensity = FogDensity * LocalState.Fog;
+    CurrentWindIntensity = bEnableWindEffects ? WindIntensity * LocalState.Wind : CurrentWindIntensity;
+
+    // Wetness moves linearly from the previous weather's level since the last change
+    const float PreviousRain = bEnableRainEffects ? FWeatherState::GetPreset(PreviousWeather).Rain : 0.0f;
+    const float TargetRain = bEnableRainEffects ? LocalState.Rain : 0.0f;
+    CurrentWetness = FMath::FInterpConstantTo(PreviousRain, TargetRain, SecondsSinceChange, TargetRain > PreviousRain ? WetnessBuildRate : WetnessDryRate);
+
+    UpdateTimeOfDay(T);
+    UpdateWeatherEffects(0.0f);
+    UpdateWindIntensity(CurrentWindIntensity);
+    UpdateAudio(0.0f);
+    PublishWeatherParameters();
+    UpdateLightningSchedule();
+
+    // Jump straight to the new time instead of blending across the gap
+    SimulationAccumulator = 0.0f;
+    CaptureRenderOutput();
+    PreviousOutput = CurrentOutput;
 }
 
 ETimeOfDay AWeatherManager::GetCurrentTimeOfDay() const
@@ -410,22 +597,64 @@ void AWeatherManager::UpdateTimeOfDay(float NormalizedTime)
     }
 }
 
+void AWeatherManager::RebuildLightingTable()
+{
+    LightingBakeParams.SunIntensity = SunIntensity;
+    LightingBakeParams.SunColor = SunColor;
+    LightingBakeParams.SkyColor = SkyColor;
+    LightingBakeParams.SunIntensityCurve = SunIntensityCurve;
+    LightingBakeParams.SunColorCurve = SunColorCurve;
+    LightingBakeParams.SkyColorCurve = SkyColorCurve;
+
+    LightingTable.Bake(LightingBakeParams);
+}
+
+void AWeatherManager::RebuildFrictionTable()
+{
+    FrictionTable.Bake(SurfaceGrip, DefaultWetGrip, DefaultSnowGrip);
+}
+
 void AWeatherManager::SetupWeatherEffects()
 {
-    // Setup VFX systems
-    if (RainVFX)
+    // Start the collections from a known state
+    PushTracker.Invalidate();
+    PublishWeatherParameters();
+}
+
+void AWeatherManager::PublishWeatherParameters()
+{
+    if (!MaterialParameterInstance && !NiagaraParameterInstance) return;
+
+    PublishScalarParameter(EWeatherPushTarget::RainIntensity, WeatherParameterNames::Rain, CurrentRainIntensity);
+    PublishScalarParameter(EWeatherPushTarget::SnowIntensity, WeatherParameterNames::Snow, CurrentSnowIntensity);
+    PublishScalarParameter(EWeatherPushTarget::WindIntensity, WeatherParameterNames::WindIntensity, CurrentWindIntensity);
+    PublishScalarParameter(EWeatherPushTarget::Wetness, WeatherParameterNames::Wetness, CurrentWetness);
+    PublishScalarParameter(EWeatherPushTarget::FogParameter, WeatherParameterNames::Fog, CurrentFogDensity);
+
+    if (ShouldPushRenderValue(EWeatherPushTarget::WindDirection, WindDirection))
     {
-        RainVFX->SetFloatParameter(FName("Intensity"), 0.0f);
+        if (MaterialParameterInstance)
+        {
+            MaterialParameterInstance->SetVectorParameterValue(WeatherParameterNames::WindDirection, FLinearColor(WindDirection));
+        }
+        if (NiagaraParameterInstance)
+        {
+            NiagaraParameterInstance->SetVectorParameter(WeatherParameterNames::WindDirection.ToString(), WindDirection);
+        }
     }
+}
 
-    if (SnowVFX)
+void AWeatherManager::PublishScalarParameter(EWeatherPushTarget Target, FName Name, float Value)
+{
+    if (!ShouldPushRenderValue(Target, Value)) return;
+
+    if (MaterialParameterInstance)
     {
-        SnowVFX->SetFloatParameter(FName("Intensity"), 0.0f);
+        MaterialParameterInstance->SetScalarParameterValue(Name, Value);
     }
-
-    if (WindVFX)
+    if (NiagaraParameterInstance)
     {
-        WindVFX->SetFloatParameter(FName("Intensity"), 0.0f);
+        NiagaraParameterInstance->SetFloatParameter(Name.ToString(), Value);
     }
 }
 
@@ -439,7 +668,6 @@ void AWeatherManager::UpdateRainIntensity(float Intensity)
             {
                 RainVFX->Activate();
             }
-            RainVFX->SetFloatParameter(FName("Intensity"), Intensity);
         }
         else
         {
@@ -461,7 +689,6 @@ void AWeatherManager::UpdateSnowIntensity(float Intensity)
             {
                 SnowVFX->Activate();
             }
-            SnowVFX->SetFloatParameter(FName("Intensity"), Intensity);
         }
         else
         {
@@ -475,7 +702,7 @@ void AWeatherManager::UpdateSnowIntensity(float Intensity)
 
 void AWeatherManager::UpdateFogDensity(float Density)
 {
-    if (HeightFog)
+    if (HeightFog && ShouldPushRenderValue(EWeatherPushTarget::FogDensity, Density))
     {
         HeightFog->SetFogDensity(Density);
     }
@@ -491,8 +718,6 @@ void AWeatherManager::UpdateWindIntensity(float Intensity)
             {
                 WindVFX->Activate();
             }
-            WindVFX->SetFloatParameter(FName("Intensity"), Intensity);
-            WindVFX->SetVectorParameter(FName("Direction"), WindDirection);
         }
         else
         {
@@ -504,37 +729,142 @@ void AWeatherManager::UpdateWindIntensity(float Intensity)
     }
 }
 
+void AWeatherManager::CreateLightningPool()
+{
+    // LightningVFX and ThunderAudio act as templates for the pooled strike emitters and thunder voices
+    LightningPool.SetNum(FMath::Max(MaxConcurrentLightningStrikes, 1));
+    for (FLightningStrikeSlot& Slot : LightningPool)
+    {
+        Slot.VFX = NewObject<UNiagaraComponent>(this);
+        Slot.VFX->SetAsset(LightningVFX ? LightningVFX->GetAsset() : nullptr);
+        Slot.VFX->SetAutoActivate(false);
+        Slot.VFX->SetUsingAbsoluteLocation(true);
+        Slot.VFX->RegisterComponent();
+
+        Slot.Thunder = NewObject<UAudioComponent>(this);
+        Slot.Thunder->SetSound(ThunderAudio ? ThunderAudio->Sound : nullptr);
+        Slot.Thunder->bAutoActivate = false;
+        Slot.Thunder->SetUsingAbsoluteLocation(true);
+        Slot.Thunder->RegisterComponent();
+    }
+}
+
+void AWeatherManager::UpdateLightningSchedule()
+{
+    FTimerManager& TimerManager = GetWorldTimerManager();
+
+    // Strikes are timer driven, so nothing runs between them
+    const float TargetRate = FMath::Max(CurrentState.LightningRate, FWeatherState::GetPreset(TargetWeather).LightningRate);
+    if (!bEnableLightningEffects || TargetRate <= 0.0f)
+    {
+        TimerManager.ClearTimer(LightningTimer);
+    }
+    else if (!TimerManager.IsTimerActive(LightningTimer))
+    {
+        ScheduleNextLightning(TargetRate);
+    }
+}
+
+void AWeatherManager::ScheduleNextLightning(float StrikesPerMinute)
+{
+    // Random interval around the average strike spacing
+    const float MeanInterval = 60.0f / StrikesPerMinute;
+    const float Interval = LightningStream.FRandRange(0.5f, 1.5f) * MeanInterval;
+    GetWorldTimerManager().SetTimer(LightningTimer, this, &AWeatherManager::OnLightningTimer, Interval, false);
+}
+
+void AWeatherManager::OnLightningTimer()
+{
+    if (!bEnableLightningEffects) return;
+
+    if (CurrentState.LightningRate > 0.0f)
+    {
+        TriggerLightning();
+    }
+
+    // Keep going while the storm is here or still rolling in
+    const float TargetRate = FMath::Max(CurrentState.LightningRate, FWeatherState::GetPreset(TargetWeather).LightningRate);
+    if (TargetRate > 0.0f)
+    {
+        ScheduleNextLightning(TargetRate);
+    }
+}
+
 void AWeatherManager::TriggerLightning()
 {
-    if (LightningVFX)
+    // Drop the strike when every pooled emitter is busy
+    const int32 SlotIndex = LightningPool.IndexOfByPredicate([](const FLightningStrikeSlot& Slot) { return !Slot.bBusy; });
+    if (SlotIndex == INDEX_NONE) return;
+
+    FLightningStrikeSlot& Slot = LightningPool[SlotIndex];
+    Slot.bBusy = true;
+
+    // Strike somewhere around the player
+    const FVector Center = GetViewLocation();
+
+    const float Angle = LightningStream.FRandRange(0.0f, 2.0f * PI);
+    const float Distance = LightningStream.FRandRange(LightningStrikeMinDistance, FMath::Max(LightningStrikeMinDistance, LightningStrikeMaxDistance));
+    const FVector StrikeLocation = Center + FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * Distance;
+
+    Slot.VFX->SetWorldLocation(StrikeLocation);
+    Slot.VFX->Activate(true);
+    Slot.Thunder->SetWorldLocation(StrikeLocation);
+
+    FTimerManager& TimerManager = GetWorldTimerManager();
+    TimerManager.SetTimer(Slot.FlashTimer, FTimerDelegate::CreateUObject(this, &AWeatherManager::EndLightningFlash, SlotIndex), LightningFlashDuration, false);
+
+    // Thunder arrives after the sound has travelled from the strike
+    const float ThunderDelay = FMath::Max(Distance / SpeedOfSound, KINDA_SMALL_NUMBER);
+    TimerManager.SetTimer(Slot.ThunderTimer, FTimerDelegate::CreateUObject(this, &AWeatherManager::PlayThunder, SlotIndex), ThunderDelay, false);
+}
+
+void AWeatherManager::EndLightningFlash(int32 SlotIndex)
+{
+    if (LightningPool.IsValidIndex(SlotIndex))
     {
-        LightningVFX->Activate(true);
-        
-        // Play thunder sound
-        if (ThunderAudio)
-        {
-            ThunderAudio->Play();
-        }
+        LightningPool[SlotIndex].VFX->Deactivate();
+    }
+}
 
-        // Deactivate lightning after a short time
-        FTimerHandle TimerHandle;
-        GetWorldTimerManager().SetTimer(TimerHandle, [this]()
-        {
-            if (LightningVFX)
-            {
-                LightningVFX->Deactivate();
-            }
-        }, 0.5f, false);
+void AWeatherManager::PlayThunder(int32 SlotIndex)
+{
+    if (!LightningPool.IsValidIndex(SlotIndex)) return;
+
+    FLightningStrikeSlot& Slot = LightningPool[SlotIndex];
+    Slot.Thunder->Play();
+
+    // Hold the slot until the thunder has rolled out
+    const USoundBase* Sound = Slot.Thunder->Sound;
+    const float ThunderLength = Sound ? FMath::Clamp(Sound->GetDuration(), 0.0f, MaxThunderDuration) : 0.0f;
+    GetWorldTimerManager().SetTimer(Slot.ThunderTimer, FTimerDelegate::CreateUObject(this, &AWeatherManager::ReleaseLightningSlot, SlotIndex), FMath::Max(ThunderLength, KINDA_SMALL_NUMBER), false);
+}
+
+void AWeatherManager::ReleaseLightningSlot(int32 SlotIndex)
+{
+    if (LightningPool.IsValidIndex(SlotIndex))
+    {
+        LightningPool[SlotIndex].bBusy = false;
     }
 }
 
-void AWeatherManager::UpdateSkyAtmosphere()
+void AWeatherManager::UpdateSkyAtmosphere(const FWeatherRenderOutput& Output)
 {
     if (SkyAtmosphere)
     {
+        // Update sky atmosphere based on weather and time
+        const float SkyIntensity = FMath::Lerp(0.3f, 1.0f, Output.SunIntensity);
+        if (ShouldPushRenderValue(EWeatherPushTarget::SkyScattering, SkyIntensity))
+        {
+            SkyAtmosphere->SetMieScatteringScale(SkyIntensity);
+            SkyAtmosphere->SetRayleighScatteringScale(SkyIntensity);
+        }
+
         // Update sky atmosphere with current colors
-        SkyAtmosphere->SetMieScatteringColor(CurrentSkyColor);
-        SkyAtmosphere->SetRayleighScatteringColor(CurrentSkyColor);
+        if (ShouldPushRenderValue(EWeatherPushTarget::SkyColor, Output.SkyColor))
+        {
+            SkyAtmosphere->SetMieScatteringColor(Output.SkyColor);
+            SkyAtmosphere->SetRayleighScatteringColor(Output.SkyColor);
+        }
     }
 }
 
@@ -570,4 +900,11 @@ void AWeatherManager::ApplyWeather(EWeatherType Type)
             // Snow system
             break;
     }
+
+    // Once per settled weather type, not per tick of the transition
+    UWeatherSubsystem* WeatherSubsystem = bIsolated ? nullptr : GetWorld()->GetSubsystem<UWeatherSubsystem>();
+    if (WeatherSubsystem)
+    {
+        WeatherSubsystem->OnWeatherTypeChanged.Broadcast(Type);
+    }
 }
@@ -1,30 +1,55 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
+#include "World/WeatherTypes.h"
+#include "World/WeatherLightingTable.h"
+#include "World/RoadFrictionTable.h"
+#include "World/WeatherPushTracker.h"
+#include "World/WeatherAudioVoiceManager.h"
+#include "World/WeatherBenchmark.h"
 #include "WeatherManager.generated.h"
 
-UENUM(BlueprintType)
-enum class EWeatherType : uint8 
-{ 
-    Clear, 
-    LightRain, 
-    HeavyRain, 
-    Foggy,
-    Stormy,
-    Snowy,
-    Cloudy
+DECLARE_STATS_GROUP(TEXT("Weather"), STATGROUP_Weather, STATCAT_Advanced);
+
+// One pooled lightning emitter with its thunder voice
+USTRUCT()
+struct FLightningStrikeSlot
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    class UNiagaraComponent* VFX = nullptr;
+
+    UPROPERTY()
+    class UAudioComponent* Thunder = nullptr;
+
+    FTimerHandle FlashTimer;
+    FTimerHandle ThunderTimer;
+    bool bBusy = false;
 };
 
-UENUM(BlueprintType)
-enum class ETimeOfDay : uint8
+// Render-facing weather values produced by each simulation step
+struct FWeatherRenderOutput
 {
-    Dawn,
-    Morning,
-    Noon,
-    Afternoon,
-    Dusk,
-    Night,
-    Midnight
+    float NormalizedTime = 0.0f;
+    float SunIntensity = 1.0f;
+    FLinearColor SunColor = FLinearColor::White;
+    FLinearColor SkyColor = FLinearColor::Blue;
+    float FogDensity = 0.0f;
+
+    static FWeatherRenderOutput Blend(const FWeatherRenderOutput& A, const FWeatherRenderOutput& B, float Alpha)
+    {
+        // Wrap time forward across midnight instead of sweeping back through the day
+        const float TimeB = B.NormalizedTime < A.NormalizedTime ? B.NormalizedTime + 1.0f : B.NormalizedTime;
+
+        FWeatherRenderOutput Result;
+        Result.NormalizedTime = FMath::Frac(FMath::Lerp(A.NormalizedTime, TimeB, Alpha));
+        Result.SunIntensity = FMath::Lerp(A.SunIntensity, B.SunIntensity, Alpha);
+        Result.SunColor = FMath::Lerp(A.SunColor, B.SunColor, Alpha);
+        Result.SkyColor = FMath::Lerp(A.SkyColor, B.SkyColor, Alpha);
+        Result.FogDensity = FMath::Lerp(A.FogDensity, B.FogDensity, Alpha);
+        return Result;
+    }
 };
 
 UCLASS()
@@ -51,7 +76,11 @@ public:
     bool bEnableDynamicWeather = true;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather")
-    float WeatherChangeInterval = 300.0f; // 5 minutes
+    float WeatherChangeInterval = 300.0f; // 5 minutes of game clock
+
+    // Seed for the dynamic weather schedule; the same seed always gives the same weather at the same time
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weather")
+    int32 WeatherSeed = 0;
 
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Atmosphere")
     float FogDensity = 0.5f;
@@ -74,6 +103,30 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
     float AmbientIntensity = 0.3f;
 
+    // Optional authored curves over normalized time (0..1); the built-in day/night bands are used when unset
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+    class UCurveFloat* SunIntensityCurve = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+    class UCurveLinearColor* SunColorCurve = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+    class UCurveLinearColor* SkyColorCurve = nullptr;
+
+    // Sample the baked lighting table instead of evaluating the bands every tick
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+    bool bUseBakedLightingTable = true;
+
+    // Tire grip relative to dry for surfaces listed here; the rest use the defaults below
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Road Grip")
+    TArray<FRoadSurfaceGrip> SurfaceGrip;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Road Grip", meta = (ClampMin = "0", ClampMax = "1"))
+    float DefaultWetGrip = 0.7f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Road Grip", meta = (ClampMin = "0", ClampMax = "1"))
+    float DefaultSnowGrip = 0.35f;
+
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
     bool bEnableRainEffects = true;
 
@@ -86,6 +139,72 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
     bool bEnableLightningEffects = true;
 
+    // Pooled strike emitters; strikes are skipped while all of them are busy
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Effects", meta = (ClampMin = "1"))
+    int32 MaxConcurrentLightningStrikes = 3;
+
+    // Strikes land in a ring around the player camera (cm)
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+    float LightningStrikeMinDistance = 2000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+    float LightningStrikeMaxDistance = 15000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+    float LightningFlashDuration = 0.5f;
+
+    // Longest a thunder voice holds its strike slot
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+    float MaxThunderDuration = 8.0f;
+
+    // Global parameters (Rain, Snow, WindIntensity, WindDirection, Wetness, Fog) read by city materials
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Effects")
+    class UMaterialParameterCollection* WeatherMaterialParameters = nullptr;
+
+    // Same parameters for Niagara systems
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Effects")
+    class UNiagaraParameterCollection* WeatherNiagaraParameters = nullptr;
+
+    // Wetness gained per second while raining and lost per second while drying
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+    float WetnessBuildRate = 0.2f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Effects")
+    float WetnessDryRate = 0.02f;
+
+    // Rain and wind loops start at this volume and keep playing until they drop below the exit volume
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio")
+    float AmbientAudioEnterVolume = 0.12f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio")
+    float AmbientAudioExitVolume = 0.05f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio")
+    float AmbientAudioFadeInTime = 1.5f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio")
+    float AmbientAudioFadeOutTime = 2.0f;
+
+    // Ambient weather loops allowed to play at once; quieter ones are virtualized
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Audio", meta = (ClampMin = "0"))
+    int32 MaxAmbientAudioVoices = 2;
+
+    // Minimum change before a light, sky, fog or VFX parameter is pushed again
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    float RenderPushEpsilon = 0.001f;
+
+    // Seconds between weather simulation steps; lights, sky and fog are interpolated in between
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.01"))
+    float SimulationInterval = 0.1f;
+
+    // Upper bound on simulation steps run in a single frame
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "1"))
+    int32 MaxSimulationStepsPerFrame = 4;
+
+    // Unchanged values are still re-pushed after this many seconds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    float RenderPushMaxStaleness = 1.0f;
+
     // Public Functions
     UFUNCTION(BlueprintCallable, Category = "Weather")
     void SetWeather(EWeatherType NewWeather);
@@ -93,29 +212,72 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Weather")
     void SetTimeOfDay(float NormalizedTime);
 
+    // Jump forward to the next time the clock reads NormalizedTime (e.g. 0.8 to skip to night)
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    void SkipToTimeOfDay(float NormalizedTime);
+
+    // Advance the game clock without ticking; weather and lighting are evaluated directly at the new time
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    void FastForward(float GameSeconds);
+
     UFUNCTION(BlueprintCallable, Category = "Weather")
     ETimeOfDay GetCurrentTimeOfDay() const;
 
+    // Blended weather targets from the last simulation step
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    FWeatherState GetWeatherState() const { return CurrentState; }
+
+    // Weather at the camera, including any weather zones
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    FWeatherState GetLocalWeatherState() const { return LocalState; }
+
     UFUNCTION(BlueprintCallable, Category = "Weather")
     float GetNormalizedTime() const { return TimeAccum / DayLengthSeconds; }
 
     UFUNCTION(BlueprintCallable, Category = "Weather")
     void SetTimeAcceleration(float NewAcceleration) { TimeAcceleration = NewAcceleration; }
 
+    // Re-bake the lighting table after changing lighting properties or curves at runtime
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    void RebuildLightingTable();
+
+    // Re-bake the road friction table after changing grip properties at runtime; vehicles
+    // pick it up on the next weather change
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    void RebuildFrictionTable();
+
+    const FRoadFrictionTable& GetFrictionTable() const { return FrictionTable; }
+
+    UFUNCTION(BlueprintCallable, Category = "Performance")
+    int32 GetRenderPushesIssuedPerSecond() const { return PushTracker.GetPushesIssuedPerSecond(); }
+
+    UFUNCTION(BlueprintCallable, Category = "Performance")
+    int32 GetRenderPushesSkippedPerSecond() const { return PushTracker.GetPushesSkippedPerSecond(); }
+
+    UFUNCTION(BlueprintCallable, Category = "Performance")
+    int32 GetAmbientVoiceStartsPerMinute() const { return AudioVoices.GetVoiceStartsPerMinute(); }
+
 protected:
     virtual void Tick(float DeltaSeconds) override;
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
-    UPROPERTY()
+    friend class FWeatherBenchmark;
+
+    // Driven world actors. Normally supplied by actors carrying a UWeatherRegistrationComponent;
+    // anything assigned here is registered with the weather subsystem at BeginPlay.
+    UPROPERTY(EditInstanceOnly, Category = "World")
     class ADirectionalLight* Sun = nullptr;
 
-    UPROPERTY()
+    UPROPERTY(EditInstanceOnly, Category = "World")
     class ASkyAtmosphere* SkyAtmosphere = nullptr;
 
-    UPROPERTY()
+    UPROPERTY(EditInstanceOnly, Category = "World")
     class AExponentialHeightFog* HeightFog = nullptr;
 
+    FDelegateHandle WeatherActorsChangedHandle;
+
     UPROPERTY()
     class UNiagaraComponent* RainVFX = nullptr;
 
@@ -128,6 +290,12 @@ private:
     UPROPERTY()
     class UNiagaraComponent* WindVFX = nullptr;
 
+    UPROPERTY()
+    class UMaterialParameterCollectionInstance* MaterialParameterInstance = nullptr;
+
+    UPROPERTY()
+    class UNiagaraParameterCollectionInstance* NiagaraParameterInstance = nullptr;
+
     UPROPERTY()
     class UAudioComponent* RainAudio = nullptr;
 
@@ -139,38 +307,107 @@ private:
 
     // State Variables
     float TimeAccum = 0.f;
+    double ScheduleTime = 0.0; // Game clock seconds, not wrapped at midnight
     ETimeOfDay CurrentTimeOfDay = ETimeOfDay::Noon;
     EWeatherType TargetWeather = EWeatherType::Clear;
     float WeatherTransitionTimer = 0.0f;
-    float WeatherChangeTimer = 0.0f;
-    float LastLightningTime = 0.0f;
-    float LightningInterval = 10.0f;
+    float WeatherTransitionAlpha = 0.0f;
+    bool bWeatherTransitioning = false; // Also set when heading back to Weather mid-transition
+    FWeatherState CurrentState;
+    FWeatherState TransitionStartState;
+    FWeatherLightingSample TransitionStartLighting; // Lighting targets when the transition started
+    FWeatherState LocalState; // CurrentState with weather zones around the camera blended in
+    EWeatherType InitialWeather = EWeatherType::Clear;
+    int64 InitialWeatherSlot = 0;
+    int64 CurrentWeatherSlot = 0;
+
+    // Lightning
+    static constexpr float SpeedOfSound = 34300.0f; // cm/s
+
+    UPROPERTY()
+    TArray<FLightningStrikeSlot> LightningPool;
+
+    FTimerHandle LightningTimer;
+    FRandomStream LightningStream;
 
     // Weather Parameters
     float CurrentFogDensity = 0.0f;
     float CurrentWindIntensity = 0.0f;
+    float CurrentRainIntensity = 0.0f;
+    float CurrentSnowIntensity = 0.0f;
+    float CurrentWetness = 0.0f;
     float CurrentSunIntensity = 1.0f;
     FLinearColor CurrentSunColor = FLinearColor::White;
     FLinearColor CurrentSkyColor = FLinearColor::Blue;
 
+    // Simulation Stepping
+    float SimulationAccumulator = 0.0f;
+    FWeatherRenderOutput PreviousOutput;
+    FWeatherRenderOutput CurrentOutput;
+
+    // Baked Lighting
+    FWeatherLightingTable LightingTable;
+    FWeatherLightingBakeParams LightingBakeParams;
+
+    // Baked Road Grip
+    FRoadFrictionTable FrictionTable;
+
+    // Render Push Tracking
+    FWeatherPushTracker PushTracker;
+
+    // Set by FWeatherBenchmark while it drives the simulation
+    FWeatherProfile* Profile = nullptr;
+
+    // Set by FWeatherBenchmark before BeginPlay: stays out of the weather subsystem, picks up
+    // none of the level's sun, sky or fog, and tells nobody about weather changes
+    bool bIsolated = false;
+
+    // Ambient Audio
+    FWeatherAudioVoiceManager AudioVoices;
+    int32 RainVoice = INDEX_NONE;
+    int32 WindVoice = INDEX_NONE;
+
+    template <typename ValueType>
+    bool ShouldPushRenderValue(EWeatherPushTarget Target, const ValueType& Value);
+
     // Enhanced Functions
-    void UpdateSun(float NormalizedTime);
-    void UpdateAtmosphere();
+    void RefreshWeatherActors();
+    void StepSimulation(float DeltaTime);
+    void CaptureRenderOutput();
+    FWeatherLightingSample SampleLighting(float NormalizedTime) const;
+    bool IsWeatherOutputVisible() const;
+    bool IsWeatherAudioAudible() const;
+    void ApplyRenderOutput(const FWeatherRenderOutput& Output);
+    void UpdateSun(float DeltaTime, const FWeatherLightingSample& Lighting);
+    void UpdateAtmosphere(float DeltaTime);
     void UpdateWeatherEffects(float DeltaTime);
-    void UpdateLighting(float DeltaTime);
+    void UpdateLighting(float DeltaTime, const FWeatherLightingSample& Lighting);
     void UpdateAudio(float DeltaTime);
     void UpdateWindEffects(float DeltaTime);
-    void UpdateLightningEffects(float DeltaTime);
     void TransitionWeather(float DeltaTime);
+    void UpdateLocalWeather();
+    FVector GetViewLocation() const;
     void ChangeWeatherRandomly();
+    int64 GetWeatherSlot(double Time) const;
+    EWeatherType GetScheduledWeather(int64 Slot) const;
+    void SeekTime(double NewTime);
     void ApplyWeather(EWeatherType Type);
     void UpdateTimeOfDay(float NormalizedTime);
     void SetupWeatherEffects();
+    void PublishWeatherParameters();
+    void PublishScalarParameter(EWeatherPushTarget Target, FName Name, float Value);
     void UpdateRainIntensity(float Intensity);
     void UpdateSnowIntensity(float Intensity);
     void UpdateFogDensity(float Density);
     void UpdateWindIntensity(float Intensity);
+    void CreateLightningPool();
+    void UpdateLightningSchedule();
+    void ScheduleNextLightning(float StrikesPerMinute);
+    void OnLightningTimer();
     void TriggerLightning();
-    void UpdateSkyAtmosphere();
+    void EndLightningFlash(int32 SlotIndex);
+    void PlayThunder(int32 SlotIndex);
+    void ReleaseLightningSlot(int32 SlotIndex);
+    void UpdateSkyAtmosphere(const FWeatherRenderOutput& Output);
     void UpdatePostProcessSettings();
 };
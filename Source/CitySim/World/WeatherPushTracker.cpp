@@ -0,0 +1,58 @@
+#include "World/WeatherPushTracker.h"
+#include "World/WeatherManager.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Render Pushes Issued/s"), STAT_WeatherPushesIssued, STATGROUP_Weather);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Render Pushes Skipped/s"), STAT_WeatherPushesSkipped, STATGROUP_Weather);
+
+bool FWeatherPushTracker::ShouldPush(EWeatherPushTarget Target, float Value, double Now)
+{
+    return ShouldPush(Target, FLinearColor(Value, 0.0f, 0.0f, 0.0f), Now);
+}
+
+bool FWeatherPushTracker::ShouldPush(EWeatherPushTarget Target, const FVector& Value, double Now)
+{
+    return ShouldPush(Target, FLinearColor(Value.X, Value.Y, Value.Z, 0.0f), Now);
+}
+
+bool FWeatherPushTracker::ShouldPush(EWeatherPushTarget Target, const FLinearColor& Value, double Now)
+{
+    FSlot& Slot = Slots[static_cast<int32>(Target)];
+
+    const bool bChanged = !Slot.bHasValue || !Slot.LastValue.Equals(Value, Epsilon);
+    const bool bStale = (Now - Slot.LastPushTime) >= MaxStaleness;
+
+    if (!bChanged && !bStale)
+    {
+        ++SkippedThisWindow;
+        return false;
+    }
+
+    Slot.LastValue = Value;
+    Slot.LastPushTime = Now;
+    Slot.bHasValue = true;
+    ++IssuedThisWindow;
+    return true;
+}
+
+void FWeatherPushTracker::Invalidate()
+{
+    for (FSlot& Slot : Slots)
+    {
+        Slot.bHasValue = false;
+    }
+}
+
+void FWeatherPushTracker::UpdateCounters(double Now)
+{
+    const double Elapsed = Now - WindowStart;
+    if (Elapsed < 1.0) return;
+
+    IssuedPerSecond = FMath::RoundToInt(IssuedThisWindow / Elapsed);
+    SkippedPerSecond = FMath::RoundToInt(SkippedThisWindow / Elapsed);
+    IssuedThisWindow = 0;
+    SkippedThisWindow = 0;
+    WindowStart = Now;
+
+    SET_DWORD_STAT(STAT_WeatherPushesIssued, IssuedPerSecond);
+    SET_DWORD_STAT(STAT_WeatherPushesSkipped, SkippedPerSecond);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include "CoreMinimal.h"
+
+// Render-facing values the weather manager pushes to lights, sky, fog and parameter collections
+enum class EWeatherPushTarget : uint8
+{
+    SunIntensity,
+    SunColor,
+    SkyScattering,
+    SkyColor,
+    FogDensity,
+    RainIntensity,
+    SnowIntensity,
+    WindIntensity,
+    WindDirection,
+    Wetness,
+    FogParameter,
+    Count
+};
+
+// Caches the last value sent to each target so unchanged values don't dirty render state.
+// A value is pushed when it moves past Epsilon or when the last push is older than MaxStaleness.
+class BELIVE_API FWeatherPushTracker
+{
+public:
+    float Epsilon = 0.001f;
+    float MaxStaleness = 1.0f;
+
+    bool ShouldPush(EWeatherPushTarget Target, float Value, double Now);
+    bool ShouldPush(EWeatherPushTarget Target, const FVector& Value, double Now);
+    bool ShouldPush(EWeatherPushTarget Target, const FLinearColor& Value, double Now);
+
+    // Forget cached values so every target is pushed on its next update
+    void Invalidate();
+
+    // Rolls the per-second counters; call once per frame
+    void UpdateCounters(double Now);
+
+    int32 GetPushesIssuedPerSecond() const { return IssuedPerSecond; }
+    int32 GetPushesSkippedPerSecond() const { return SkippedPerSecond; }
+
+private:
+    struct FSlot
+    {
+        FLinearColor LastValue = FLinearColor::Transparent;
+        double LastPushTime = 0.0;
+        bool bHasValue = false;
+    };
+
+    FSlot Slots[static_cast<int32>(EWeatherPushTarget::Count)];
+
+    int32 IssuedThisWindow = 0;
+    int32 SkippedThisWindow = 0;
+    int32 IssuedPerSecond = 0;
+    int32 SkippedPerSecond = 0;
+    double WindowStart = 0.0;
+};
@@ -0,0 +1,56 @@
+#include "World/WeatherRegistrationComponent.h"
+#include "World/WeatherSubsystem.h"
+#include "Engine/DirectionalLight.h"
+#include "Engine/SkyAtmosphere.h"
+#include "Engine/ExponentialHeightFog.h"
+#include "Engine/World.h"
+
+void UWeatherRegistrationComponent::OnRegister()
+{
+    Super::OnRegister();
+
+    UWorld* World = GetWorld();
+    UWeatherSubsystem* WeatherSubsystem = World ? World->GetSubsystem<UWeatherSubsystem>() : nullptr;
+    if (!WeatherSubsystem) return;
+
+    AActor* Owner = GetOwner();
+    if (ADirectionalLight* Light = Cast<ADirectionalLight>(Owner))
+    {
+        WeatherSubsystem->RegisterSun(Light);
+    }
+    else if (ASkyAtmosphere* Sky = Cast<ASkyAtmosphere>(Owner))
+    {
+        WeatherSubsystem->RegisterSkyAtmosphere(Sky);
+    }
+    else if (AExponentialHeightFog* Fog = Cast<AExponentialHeightFog>(Owner))
+    {
+        WeatherSubsystem->RegisterHeightFog(Fog);
+    }
+    else
+    {
+        UE_LOG(LogTemp, Warning, TEXT("%s: weather registration only supports directional light, sky atmosphere and height fog actors"), *GetNameSafe(Owner));
+    }
+}
+
+void UWeatherRegistrationComponent::OnUnregister()
+{
+    UWorld* World = GetWorld();
+    if (UWeatherSubsystem* WeatherSubsystem = World ? World->GetSubsystem<UWeatherSubsystem>() : nullptr)
+    {
+        AActor* Owner = GetOwner();
+        if (ADirectionalLight* Light = Cast<ADirectionalLight>(Owner))
+        {
+            WeatherSubsystem->UnregisterSun(Light);
+        }
+        else if (ASkyAtmosphere* Sky = Cast<ASkyAtmosphere>(Owner))
+        {
+            WeatherSubsystem->UnregisterSkyAtmosphere(Sky);
+        }
+        else if (AExponentialHeightFog* Fog = Cast<AExponentialHeightFog>(Owner))
+        {
+            WeatherSubsystem->UnregisterHeightFog(Fog);
+        }
+    }
+
+    Super::OnUnregister();
+}
@@ -0,0 +1,16 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "WeatherRegistrationComponent.generated.h"
+
+// Add to the level's sun (directional light), sky atmosphere or height fog actor
+// so the weather subsystem knows about it without searching the world.
+UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
+class BELIVE_API UWeatherRegistrationComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+protected:
+    virtual void OnRegister() override;
+    virtual void OnUnregister() override;
+};
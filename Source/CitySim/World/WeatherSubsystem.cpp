@@ -0,0 +1,163 @@
+#include "World/WeatherSubsystem.h"
+#include "World/WeatherManager.h"
+#include "World/WeatherZone.h"
+#include "Engine/DirectionalLight.h"
+#include "Engine/SkyAtmosphere.h"
+#include "Engine/ExponentialHeightFog.h"
+
+void UWeatherSubsystem::RegisterWeatherManager(AWeatherManager* Manager)
+{
+    if (WeatherManager.IsValid() && WeatherManager.Get() != Manager)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Multiple weather managers registered, using %s"), *GetNameSafe(Manager));
+    }
+    WeatherManager = Manager;
+}
+
+void UWeatherSubsystem::UnregisterWeatherManager(AWeatherManager* Manager)
+{
+    if (WeatherManager.Get() == Manager)
+    {
+        WeatherManager.Reset();
+    }
+}
+
+void UWeatherSubsystem::RegisterSun(ADirectionalLight* Light)
+{
+    Sun = Light;
+    OnWeatherActorsChanged.Broadcast();
+}
+
+void UWeatherSubsystem::UnregisterSun(ADirectionalLight* Light)
+{
+    if (Sun.Get() == Light)
+    {
+        Sun.Reset();
+        OnWeatherActorsChanged.Broadcast();
+    }
+}
+
+void UWeatherSubsystem::RegisterSkyAtmosphere(ASkyAtmosphere* Sky)
+{
+    SkyAtmosphere = Sky;
+    OnWeatherActorsChanged.Broadcast();
+}
+
+void UWeatherSubsystem::UnregisterSkyAtmosphere(ASkyAtmosphere* Sky)
+{
+    if (SkyAtmosphere.Get() == Sky)
+    {
+        SkyAtmosphere.Reset();
+        OnWeatherActorsChanged.Broadcast();
+    }
+}
+
+void UWeatherSubsystem::RegisterHeightFog(AExponentialHeightFog* Fog)
+{
+    HeightFog = Fog;
+    OnWeatherActorsChanged.Broadcast();
+}
+
+void UWeatherSubsystem::UnregisterHeightFog(AExponentialHeightFog* Fog)
+{
+    if (HeightFog.Get() == Fog)
+    {
+        HeightFog.Reset();
+        OnWeatherActorsChanged.Broadcast();
+    }
+}
+
+void UWeatherSubsystem::RegisterWeatherZone(AWeatherZone* Zone)
+{
+    ForEachZoneCell(Zone, [this, Zone](const FIntPoint& Cell)
+    {
+        ZoneGrid.FindOrAdd(Cell).AddUnique(Zone);
+    });
+}
+
+void UWeatherSubsystem::UnregisterWeatherZone(AWeatherZone* Zone)
+{
+    ForEachZoneCell(Zone, [this, Zone](const FIntPoint& Cell)
+    {
+        if (TArray<TWeakObjectPtr<AWeatherZone>>* Zones = ZoneGrid.Find(Cell))
+        {
+            Zones->Remove(Zone);
+            if (Zones->Num() == 0)
+            {
+                ZoneGrid.Remove(Cell);
+            }
+        }
+    });
+}
+
+FIntPoint UWeatherSubsystem::GetZoneCell(const FVector& Location)
+{
+    return FIntPoint(FMath::FloorToInt(Location.X / ZoneCellSize), FMath::FloorToInt(Location.Y / ZoneCellSize));
+}
+
+void UWeatherSubsystem::ForEachZoneCell(const AWeatherZone* Zone, TFunctionRef<void(const FIntPoint&)> Visitor) const
+{
+    const FVector Center = Zone->GetActorLocation();
+    const FVector Extent(Zone->GetInfluenceRadius(), Zone->GetInfluenceRadius(), 0.0f);
+    const FIntPoint Min = GetZoneCell(Center - Extent);
+    const FIntPoint Max = GetZoneCell(Center + Extent);
+
+    for (int32 X = Min.X; X <= Max.X; ++X)
+    {
+        for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+        {
+            Visitor(FIntPoint(X, Y));
+        }
+    }
+}
+
+EWeatherType UWeatherSubsystem::GetCurrentWeather() const
+{
+    const AWeatherManager* Manager = WeatherManager.Get();
+    return Manager ? Manager->Weather : EWeatherType::Clear;
+}
+
+FWeatherState UWeatherSubsystem::GetWeatherState() const
+{
+    const AWeatherManager* Manager = WeatherManager.Get();
+    return Manager ? Manager->GetWeatherState() : FWeatherState::GetPreset(EWeatherType::Clear);
+}
+
+FWeatherState UWeatherSubsystem::GetWeatherStateAtLocation(const FVector& Location) const
+{
+    FWeatherState State = GetWeatherState();
+
+    const TArray<TWeakObjectPtr<AWeatherZone>>* Zones = ZoneGrid.Find(GetZoneCell(Location));
+    if (!Zones) return State;
+
+    // Weakest zone first so the strongest one ends up on top where zones overlap
+    TArray<TPair<float, const AWeatherZone*>, TInlineAllocator<4>> Weighted;
+    for (const TWeakObjectPtr<AWeatherZone>& ZonePtr : *Zones)
+    {
+        const AWeatherZone* Zone = ZonePtr.Get();
+        const float Influence = Zone ? Zone->GetInfluence(Location) : 0.0f;
+        if (Influence > 0.0f)
+        {
+            Weighted.Emplace(Influence, Zone);
+        }
+    }
+    Weighted.Sort([](const TPair<float, const AWeatherZone*>& A, const TPair<float, const AWeatherZone*>& B) { return A.Key < B.Key; });
+
+    for (const TPair<float, const AWeatherZone*>& Entry : Weighted)
+    {
+        State = FWeatherState::Blend(State, FWeatherState::GetPreset(Entry.Value->Weather), Entry.Key);
+    }
+    return State;
+}
+
+float UWeatherSubsystem::GetNormalizedTime() const
+{
+    const AWeatherManager* Manager = WeatherManager.Get();
+    return Manager ? Manager->GetNormalizedTime() : 0.5f;
+}
+
+ETimeOfDay UWeatherSubsystem::GetTimeOfDay() const
+{
+    const AWeatherManager* Manager = WeatherManager.Get();
+    return Manager ? Manager->GetCurrentTimeOfDay() : ETimeOfDay::Noon;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "World/WeatherTypes.h"
+#include "WeatherSubsystem.generated.h"
+
+class AWeatherManager;
+class ADirectionalLight;
+class ASkyAtmosphere;
+class AExponentialHeightFog;
+class AWeatherZone;
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnWeatherTypeChanged, EWeatherType);
+
+// World-wide registry for the weather manager and the sun, sky and fog it drives.
+// Anything that needs weather data asks here instead of iterating actors.
+UCLASS()
+class BELIVE_API UWeatherSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // Registration
+    void RegisterWeatherManager(AWeatherManager* Manager);
+    void UnregisterWeatherManager(AWeatherManager* Manager);
+    void RegisterSun(ADirectionalLight* Light);
+    void UnregisterSun(ADirectionalLight* Light);
+    void RegisterSkyAtmosphere(ASkyAtmosphere* Sky);
+    void UnregisterSkyAtmosphere(ASkyAtmosphere* Sky);
+    void RegisterHeightFog(AExponentialHeightFog* Fog);
+    void UnregisterHeightFog(AExponentialHeightFog* Fog);
+    void RegisterWeatherZone(AWeatherZone* Zone);
+    void UnregisterWeatherZone(AWeatherZone* Zone);
+
+    // Fired when the sun, sky or fog registration changes
+    FSimpleMulticastDelegate OnWeatherActorsChanged;
+
+    // Fired by the weather manager when it starts up and whenever a transition completes
+    FOnWeatherTypeChanged OnWeatherTypeChanged;
+
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    AWeatherManager* GetWeatherManager() const { return WeatherManager.Get(); }
+
+    ADirectionalLight* GetSun() const { return Sun.Get(); }
+    ASkyAtmosphere* GetSkyAtmosphere() const { return SkyAtmosphere.Get(); }
+    AExponentialHeightFog* GetHeightFog() const { return HeightFog.Get(); }
+
+    // Weather queries; defaults are returned when no manager is registered
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    EWeatherType GetCurrentWeather() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    FWeatherState GetWeatherState() const;
+
+    // Global weather with any weather zones covering Location blended on top
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    FWeatherState GetWeatherStateAtLocation(const FVector& Location) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    float GetNormalizedTime() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    ETimeOfDay GetTimeOfDay() const;
+
+private:
+    TWeakObjectPtr<AWeatherManager> WeatherManager;
+    TWeakObjectPtr<ADirectionalLight> Sun;
+    TWeakObjectPtr<ASkyAtmosphere> SkyAtmosphere;
+    TWeakObjectPtr<AExponentialHeightFog> HeightFog;
+
+    // Uniform grid over the XY plane; each cell lists the zones whose influence overlaps it,
+    // so a location lookup is one hash probe plus the few zones in that cell
+    static constexpr float ZoneCellSize = 25000.0f;
+    TMap<FIntPoint, TArray<TWeakObjectPtr<AWeatherZone>>> ZoneGrid;
+
+    static FIntPoint GetZoneCell(const FVector& Location);
+    void ForEachZoneCell(const AWeatherZone* Zone, TFunctionRef<void(const FIntPoint&)> Visitor) const;
+};
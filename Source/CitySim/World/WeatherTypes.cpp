@@ -0,0 +1,45 @@
+#include "World/WeatherTypes.h"
+
+const FWeatherState& FWeatherState::GetPreset(EWeatherType Type)
+{
+    auto MakePreset = [](float Rain, float Snow, float Fog, float Wind, float SkyDarkening, float LightningRate, float RainVolume)
+    {
+        FWeatherState State;
+        State.Rain = Rain;
+        State.Snow = Snow;
+        State.Fog = Fog;
+        State.Wind = Wind;
+        State.SkyDarkening = SkyDarkening;
+        State.LightningRate = LightningRate;
+        State.RainVolume = RainVolume;
+        return State;
+    };
+
+    // Indexed by EWeatherType
+    static const FWeatherState Presets[NumWeatherTypes] =
+    {
+        //          Rain  Snow  Fog   Wind  Dark  Strikes Volume
+        MakePreset(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f), // Clear
+        MakePreset(0.3f, 0.0f, 0.3f, 0.5f, 0.0f, 0.0f, 0.3f), // LightRain
+        MakePreset(1.0f, 0.0f, 0.7f, 1.5f, 0.5f, 0.0f, 0.8f), // HeavyRain
+        MakePreset(0.0f, 0.0f, 1.0f, 0.0f, 0.3f, 0.0f, 0.0f), // Foggy
+        MakePreset(1.0f, 0.0f, 0.7f, 2.0f, 0.5f, 6.0f, 0.8f), // Stormy
+        MakePreset(0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f), // Snowy
+        MakePreset(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f), // Cloudy
+    };
+
+    return Presets[static_cast<int32>(Type)];
+}
+
+FWeatherState FWeatherState::Blend(const FWeatherState& A, const FWeatherState& B, float Alpha)
+{
+    FWeatherState Result;
+    Result.Rain = FMath::Lerp(A.Rain, B.Rain, Alpha);
+    Result.Snow = FMath::Lerp(A.Snow, B.Snow, Alpha);
+    Result.Fog = FMath::Lerp(A.Fog, B.Fog, Alpha);
+    Result.Wind = FMath::Lerp(A.Wind, B.Wind, Alpha);
+    Result.SkyDarkening = FMath::Lerp(A.SkyDarkening, B.SkyDarkening, Alpha);
+    Result.LightningRate = FMath::Lerp(A.LightningRate, B.LightningRate, Alpha);
+    Result.RainVolume = FMath::Lerp(A.RainVolume, B.RainVolume, Alpha);
+    return Result;
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "WeatherTypes.generated.h"
+
+UENUM(BlueprintType)
+enum class EWeatherType : uint8 
+{ 
+    Clear, 
+    LightRain, 
+    HeavyRain, 
+    Foggy,
+    Stormy,
+    Snowy,
+    Cloudy
+};
+
+UENUM(BlueprintType)
+enum class ETimeOfDay : uint8
+{
+    Dawn,
+    Morning,
+    Noon,
+    Afternoon,
+    Dusk,
+    Night,
+    Midnight
+};
+
+// Keep in sync with the last entry of EWeatherType
+constexpr int32 NumWeatherTypes = static_cast<int32>(EWeatherType::Cloudy) + 1;
+
+// Numeric weather targets. Each EWeatherType has a preset; the manager blends
+// between presets during transitions and every consumer reads the result.
+USTRUCT(BlueprintType)
+struct FWeatherState
+{
+    GENERATED_BODY()
+
+    // Rain and snow particle intensity, 0..1
+    UPROPERTY(BlueprintReadOnly, Category = "Weather")
+    float Rain = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Weather")
+    float Snow = 0.0f;
+
+    // Scales AWeatherManager::FogDensity
+    UPROPERTY(BlueprintReadOnly, Category = "Weather")
+    float Fog = 0.0f;
+
+    // Scales AWeatherManager::WindIntensity
+    UPROPERTY(BlueprintReadOnly, Category = "Weather")
+    float Wind = 0.0f;
+
+    // Fraction of sky color removed by cloud cover
+    UPROPERTY(BlueprintReadOnly, Category = "Weather")
+    float SkyDarkening = 0.0f;
+
+    // Average lightning strikes per minute
+    UPROPERTY(BlueprintReadOnly, Category = "Weather")
+    float LightningRate = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Weather")
+    float RainVolume = 0.0f;
+
+    static const FWeatherState& GetPreset(EWeatherType Type);
+    static FWeatherState Blend(const FWeatherState& A, const FWeatherState& B, float Alpha);
+};
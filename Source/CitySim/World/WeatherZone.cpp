@@ -0,0 +1,51 @@
+#include "World/WeatherZone.h"
+#include "World/WeatherSubsystem.h"
+#include "Components/SphereComponent.h"
+#include "Engine/World.h"
+
+AWeatherZone::AWeatherZone()
+{
+    PrimaryActorTick.bCanEverTick = false;
+
+    Bounds = CreateDefaultSubobject<USphereComponent>(TEXT("Bounds"));
+    Bounds->SetSphereRadius(10000.0f);
+    Bounds->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Bounds->SetGenerateOverlapEvents(false);
+    Bounds->SetMobility(EComponentMobility::Static);
+    RootComponent = Bounds;
+}
+
+void AWeatherZone::BeginPlay()
+{
+    Super::BeginPlay();
+
+    if (UWeatherSubsystem* WeatherSubsystem = GetWorld()->GetSubsystem<UWeatherSubsystem>())
+    {
+        WeatherSubsystem->RegisterWeatherZone(this);
+    }
+}
+
+void AWeatherZone::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (UWeatherSubsystem* WeatherSubsystem = GetWorld()->GetSubsystem<UWeatherSubsystem>())
+    {
+        WeatherSubsystem->UnregisterWeatherZone(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+float AWeatherZone::GetInfluence(const FVector& Location) const
+{
+    const float Radius = Bounds->GetScaledSphereRadius();
+    const float Distance = FVector::Dist2D(GetActorLocation(), Location);
+    if (Distance <= Radius) return 1.0f;
+    if (BlendDistance <= 0.0f) return 0.0f;
+
+    return 1.0f - FMath::SmoothStep(Radius, Radius + BlendDistance, Distance);
+}
+
+float AWeatherZone::GetInfluenceRadius() const
+{
+    return Bounds->GetScaledSphereRadius() + BlendDistance;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "World/WeatherTypes.h"
+#include "WeatherZone.generated.h"
+
+// Regional weather, e.g. fog over the harbor. Full strength inside the sphere and fading
+// back to the global weather over BlendDistance. Zones are indexed by the weather subsystem
+// at BeginPlay and are expected to stay put.
+UCLASS()
+class BELIVE_API AWeatherZone : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    AWeatherZone();
+
+    UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
+    class USphereComponent* Bounds = nullptr;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weather")
+    EWeatherType Weather = EWeatherType::Foggy;
+
+    // Distance beyond the sphere over which the zone fades out
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Weather", meta = (ClampMin = "0"))
+    float BlendDistance = 5000.0f;
+
+    UFUNCTION(BlueprintCallable, Category = "Weather")
+    void SetWeather(EWeatherType NewWeather) { Weather = NewWeather; }
+
+    // 0..1 weight of this zone at Location; horizontal distance only
+    float GetInfluence(const FVector& Location) const;
+
+    // Horizontal distance from the center at which the influence reaches zero
+    float GetInfluenceRadius() const;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+};
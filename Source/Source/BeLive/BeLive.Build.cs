@@ -14,6 +14,8 @@ public class BeLive : ModuleRules
 			"HeadMountedDisplay",
 			"EnhancedInput",
 			"ChaosVehicles",
+			"Chaos",
+			"PhysicsCore",
 			"NavigationSystem",
 			"Niagara",
 			"GameplayTasks",